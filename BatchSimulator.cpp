@@ -0,0 +1,437 @@
+/**
+ * @file BatchSimulator.cpp
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Contains implementation of the public interface and private methods of
+ * the BatchSimulator class. For details about this class, see 'BatchSimulator.h'.
+ */
+
+//Protected includes
+#include <ostream>
+#include <stdexcept>
+#include <vector>
+
+//Class header include
+#include "BatchSimulator.h"
+
+//Class dependencies
+#include "SimulatorConfig.h"
+#include "Board.h"
+#include "BoardDefinition.h"
+#include "Player.h"
+#include "Property.h"
+#include "Dice.h"
+
+using namespace std;
+
+//Lane counters are flushed into the 64-bit totals after this many rounds,
+//well before any single lane's 32-bit counter could overflow
+static const int FLUSH_INTERVAL = 1 << 20;
+
+/*** Public interface implementation ***/
+
+/**
+ * BatchSimulator class constructor. Accepts an existing SimulatorConfig object
+ * describing the simulation parameters. Copies the lookup tables that the
+ * lockstep loops index directly from its BoardDefinition; no Board is built, and
+ * the Properties' names are only read from the definition when they are printed.
+ *
+ * @param 	config 	An existing SimulatorConfig object
+ */
+BatchSimulator::BatchSimulator(SimulatorConfig config)
+: config_(config), definition_(config.board()), round_callback_(NULL), round_user_data_(NULL) {
+	//Tile kinds and 'nearest' jump targets, indexed by Board location
+	this->board_size_ = this->definition_->size();
+	this->jail_location_ = this->definition_->jailLocation();
+	for(int i = 0; i < this->board_size_; i++) {
+		this->kind_[i] = this->definition_->kind(i);
+		this->nearest_railroad_[i] = this->definition_->nearestRailroad(i);
+		this->nearest_utility_[i] = this->definition_->nearestUtility(i);
+	}
+	//Lane state
+	for(int d = 0; d < CardDecks::DECK_COUNT; d++) {
+		this->deck_cards_[d].resize(LANES * CardDecks::MAXIMUM_DECK_SIZE);
+		this->deck_cursors_[d].resize(LANES);
+		this->deck_shuffles_[d].resize(LANES);
+	}
+	this->die1_.resize(LANES);
+	this->die2_.resize(LANES);
+	this->active_.resize(LANES);
+	this->moved_.resize(LANES);
+	this->lane_counts_.resize(this->board_size_ * LANES);
+	this->reconfigure(config);
+}
+
+//BatchSimulator class destructor
+BatchSimulator::~BatchSimulator() { }
+
+/**
+ * Moves the BatchSimulator on to a different configuration (e.g. another player
+ * or turn count), keeping its Board tables, and clears the running totals.
+ * Throws an invalid_argument exception if the configuration is verbose, or is
+ * played on a different board.
+ *
+ * @param 	config 	An existing SimulatorConfig object
+ */
+void BatchSimulator::reconfigure(SimulatorConfig config) {
+	if(config.isVerbose()) {
+		throw invalid_argument("Verbose output is not available in batch mode!");
+	}
+	if(config.board() != this->definition_) {
+		throw invalid_argument("A BatchSimulator can't be moved on to a different board!");
+	}
+	this->config_ = config;
+	this->seed_ = this->config_.resolvedSeed();
+	//Per-Player lane state
+	int player_lanes = this->config_.playerCount() * LANES;
+	this->players_.resize(player_lanes);
+	this->dice_.resize(player_lanes);
+	for(int i = 0; i < this->board_size_; i++) {
+		this->counts_[i] = 0;
+	}
+}
+
+/**
+ * Sets the function called after every round (or clears it, given NULL).
+ *
+ * @param 	callback 	The function to call
+ * @param 	user_data 	Passed to every call, untouched
+ */
+void BatchSimulator::setRoundCallback(RoundCallback callback, void* user_data) {
+	this->round_callback_ = callback;
+	this->round_user_data_ = user_data;
+}
+
+/**
+ * Simulates a contiguous range of games, LANES games at a time, adding their
+ * landing counts to the running totals.
+ *
+ * @param 	first_game 	The index of the first game to simulate
+ * @param 	game_count 	The number of games to simulate
+ */
+void BatchSimulator::simulateGames(int first_game, int game_count) {
+	Game games[LANES];
+	for(int g = first_game; g < first_game + game_count; g += LANES) {
+		int lanes = (first_game + game_count - g < LANES) ? first_game + game_count - g : LANES;
+		for(int l = 0; l < lanes; l++) {
+			games[l].seed = this->seed_;
+			games[l].index = g + l;
+		}
+		this->simulateGames(games, lanes);
+	}
+}
+
+/**
+ * Simulates a list of games, each with its own seed, LANES games at a time,
+ * adding their landing counts to the running totals.
+ *
+ * @param 	games 			The games to simulate
+ * @param 	game_count 		The number of games in the list
+ * @param 	game_counts 	If given, each game's landing counts are added to its
+ * 							own board size elements ([game * size + tile])
+ */
+void BatchSimulator::simulateGames(const Game* games, int game_count, unsigned long long* game_counts) {
+	for(int g = 0; g < game_count; g += LANES) {
+		int lanes = (game_count - g < LANES) ? game_count - g : LANES;
+		unsigned long long* lane_totals = game_counts ? game_counts + g * this->board_size_ : NULL;
+		this->resetLanes(games + g, lanes);
+		for(int r_index = 0; r_index < this->config_.turnCount(); r_index++) {
+			for(int p_index = 0; p_index < this->config_.playerCount(); p_index++) {
+				this->simulateTurns(p_index, lanes);
+			}
+			if(this->round_callback_) {
+				this->flushCounts(lanes, lane_totals);
+				this->round_callback_(r_index, this->counts_, this->round_user_data_);
+			} else
+			if((r_index + 1) % FLUSH_INTERVAL == 0) {
+				this->flushCounts(lanes, lane_totals);
+			}
+		}
+		this->flushCounts(lanes, lane_totals);
+	}
+}
+
+/* Returns the total number of landings on the nth Property, over all games */
+unsigned long long BatchSimulator::landingCount(int n) const {
+	return this->counts_[Board::wrapIndex(n, 0, this->board_size_ - 1)];
+}
+
+/* Outputs 'landed on' statistics for all Properties on the Board */
+void BatchSimulator::printPropertyStatistics(ostream& output) const {
+	output << "\n";
+	for(int i = 0; i < this->board_size_; i++) {
+		output << this->definition_->tileName(i) << " :: " << this->counts_[i] << "\n";
+	}
+}
+
+/*** Private method implementation ***/
+
+/**
+ * Puts every lane back into the state of a new game: all Players on 'Go',
+ * both decks stacked and shuffled (unless the decks stay in order), and each
+ * Player's dice stream and each deck's shuffle stream keyed to its game.
+ *
+ * @param 	games 	The games simulated by each lane in use
+ * @param 	lanes 	The number of lanes in use
+ */
+void BatchSimulator::resetLanes(const Game* games, int lanes) {
+	for(int p = 0; p < this->config_.playerCount(); p++) {
+		for(int l = 0; l < LANES; l++) {
+			this->players_[p * LANES + l] = PlayerState();
+		}
+		//Lanes that are not in use never roll
+		for(int l = 0; l < lanes; l++) {
+			this->dice_[p * LANES + l] = DiceStream(games[l].seed, games[l].index, p);
+		}
+	}
+	for(int d = 0; d < CardDecks::DECK_COUNT; d++) {
+		int size = this->definition_->deckSize((CardDecks::Deck)d);
+		for(int l = 0; l < lanes; l++) {
+			for(int c = 0; c < size; c++) {
+				this->deck_cards_[d][l * CardDecks::MAXIMUM_DECK_SIZE + c] = c;
+			}
+			this->deck_cursors_[d][l].reset(size);
+			this->deck_shuffles_[d][l] = ShuffleStream(games[l].seed, games[l].index, d);
+			if(this->config_.shufflePolicy() != CardDecks::UNSHUFFLED) {
+				this->shuffleDeck((CardDecks::Deck)d, l);
+			}
+		}
+	}
+	for(unsigned int i = 0; i < this->lane_counts_.size(); i++) {
+		this->lane_counts_[i] = 0;
+	}
+}
+
+/**
+ * Simulates one turn for the given Player in every lane. Follows the same turn
+ * states as Simulator::simulateTurn(), making up to three passes (one per roll)
+ * over the lanes and masking out lanes whose turn has already ended.
+ *
+ * @param 	player 	The index of the Player taking their turn
+ * @param 	lanes 	The number of lanes in use
+ */
+void BatchSimulator::simulateTurns(int player, int lanes) {
+	PlayerState* state = &this->players_[player * LANES];
+	unsigned char* die1 = &this->die1_[0];
+	unsigned char* die2 = &this->die2_[0];
+	unsigned char* active = &this->active_[0];
+	unsigned char* moved = &this->moved_[0];
+	unsigned int* counts = &this->lane_counts_[0];
+	const unsigned char* kind = this->kind_;
+	const int board_size = this->board_size_;
+	const int jail_location = this->jail_location_;
+
+	//Detained Players holding a 'Get Out of Jail Free' card use it before rolling
+	for(int l = 0; l < lanes; l++) {
+		if(state[l].isDetained() && state[l].hasGetOutOfJailCard()) {
+			this->useGetOutOfJailCard(player, l);
+		}
+		active[l] = 1;
+	}
+
+	for(int r_depth = 0; r_depth < 3; r_depth++) {
+
+		//Roll the dice for every lane whose turn is still going
+		for(int l = 0; l < lanes; l++) {
+			if(active[l]) {
+				die1[l] = this->getDiceRoll(player, l);
+				die2[l] = this->getDiceRoll(player, l);
+			}
+		}
+
+		//Resolve the roll (the JAIL and ROLLED states of Simulator::simulateTurn) without branches
+		for(int l = 0; l < lanes; l++) {
+			PlayerState s = state[l];
+			int location = s.location();
+			int jailed = s.isDetained();
+			int turns = s.turnsInJail();
+			int a = active[l];
+			int doubles = (die1[l] == die2[l]);
+			int release = a & jailed & (doubles | (turns >= PlayerState::MAXIMUM_JAIL_SENTENCE));
+			int arrest = a & (1 - jailed) & doubles & (r_depth >= 2);
+			int move = a & (((1 - jailed) & (1 - arrest)) | release);
+			int stay = a & jailed & (1 - release);
+			int destination = location + die1[l] + die2[l];
+			destination -= (destination >= board_size) ? board_size : 0;
+			destination = move ? destination : (arrest ? jail_location : location);
+			s.setLocation(destination);
+			s.setJail(arrest | (jailed & (1 - release)), (release | arrest) ? 0 : turns + stay);
+			state[l] = s;
+			counts[destination * LANES + l] += move | arrest;
+			moved[l] = move;
+			active[l] = move & doubles;
+		}
+
+		//Landing on 'Go To Jail' sends the Player straight to Jail
+		for(int l = 0; l < lanes; l++) {
+			PlayerState s = state[l];
+			int arrest = moved[l] & (kind[s.location()] == Property::GO_TO_JAIL);
+			s.setLocation(arrest ? jail_location : s.location());
+			s.setJail(s.isDetained() | arrest, arrest ? 0 : s.turnsInJail());
+			state[l] = s;
+			counts[jail_location * LANES + l] += arrest;
+		}
+
+		//Card draws are rare enough to resolve one lane at a time
+		for(int l = 0; l < lanes; l++) {
+			if(moved[l]) {
+				int location = state[l].location();
+				if(kind[location] == Property::CHANCE) {
+					this->drawCard(CardDecks::CHANCE_DECK, player, l);
+				} else
+				if(kind[location] == Property::COMMUNITY_CHEST) {
+					this->drawCard(CardDecks::COMMUNITY_CHEST_DECK, player, l);
+				}
+			}
+		}
+
+		//Doubles earn another roll, unless the Player ended up in Jail
+		for(int l = 0; l < lanes; l++) {
+			active[l] &= (1 - (int)state[l].isDetained());
+		}
+
+	}
+
+}
+
+/**
+ * Adds each lane's landing counters to the totals (and, if given, to the counts
+ * of the lane's own game), and clears them.
+ */
+void BatchSimulator::flushCounts(int lanes, unsigned long long* game_counts) {
+	for(int i = 0; i < this->board_size_; i++) {
+		unsigned long long sum = 0;
+		for(int l = 0; l < lanes; l++) {
+			sum += this->lane_counts_[i * LANES + l];
+			if(game_counts) {
+				game_counts[l * this->board_size_ + i] += this->lane_counts_[i * LANES + l];
+			}
+			this->lane_counts_[i * LANES + l] = 0;
+		}
+		this->counts_[i] += sum;
+	}
+}
+
+/* Rolls a single die from the given Player's random stream in the given lane */
+int BatchSimulator::getDiceRoll(int player, int lane) {
+	return this->dice_[player * LANES + lane].roll();
+}
+
+/**
+ * Lane-by-lane counterpart of Simulator::landOn(), used when a card moves a
+ * Player. Places the Player, counts the landing and has the Property respond.
+ *
+ * @param 	player 	The index of a Player
+ * @param 	lane 	The lane (game) being resolved
+ * @param 	index 	A Property index in the range [0, board size)
+ */
+void BatchSimulator::landOn(int player, int lane, int index) {
+	this->players_[player * LANES + lane].setLocation(index);
+	this->lane_counts_[index * LANES + lane]++;
+	switch(this->kind_[index]) {
+		case Property::GO_TO_JAIL:
+			this->arrestPlayer(player, lane);
+			break;
+		case Property::CHANCE:
+			this->drawCard(CardDecks::CHANCE_DECK, player, lane);
+			break;
+		case Property::COMMUNITY_CHEST:
+			this->drawCard(CardDecks::COMMUNITY_CHEST_DECK, player, lane);
+			break;
+		default:
+			//No-op
+			break;
+	}
+}
+
+/* Moves a Player to the Jail, updating that Player's state */
+void BatchSimulator::arrestPlayer(int player, int lane) {
+	PlayerState& state = this->players_[player * LANES + lane];
+	state.setLocation(this->jail_location_);
+	state.setDetention(true);
+	this->lane_counts_[this->jail_location_ * LANES + lane]++;
+}
+
+/**
+ * Draws the card at the front of a lane's deck and follows it. As in the
+ * Simulator, the card leaves the deck while it is being followed and then
+ * returns to the back, unless it is a 'Get Out of Jail Free' card.
+ */
+void BatchSimulator::drawCard(CardDecks::Deck deck, int player, int lane) {
+	DeckCursor& cursor = this->deck_cursors_[deck][lane];
+	//Once every card has been drawn since the last shuffle, shuffle again if asked to
+	if(this->config_.shufflePolicy() == CardDecks::SHUFFLE_WHEN_EXHAUSTED) {
+		if(cursor.undrawn() == 0) {
+			this->shuffleDeck(deck, lane);
+		}
+		cursor.countDraw();
+	}
+	int size = this->definition_->deckSize(deck);
+	unsigned char* cards = &this->deck_cards_[deck][lane * CardDecks::MAXIMUM_DECK_SIZE];
+	int id = cards[cursor.head()];
+	cursor.pop(size);
+	const Card& card = this->definition_->card(deck, id);
+	int location = this->players_[player * LANES + lane].location();
+	switch(card.effect()) {
+		case Card::KEEP_CARD:
+			//Keep the card rather than returning it to the deck
+			this->players_[player * LANES + lane].setGetOutOfJailCard(deck, true);
+			return;
+		case Card::MOVE_TO:
+			this->landOn(player, lane, card.argument());
+			break;
+		case Card::MOVE_BY:
+			this->landOn(player, lane, Board::wrapIndex(location + card.argument(), 0, this->board_size_ - 1));
+			break;
+		case Card::MOVE_TO_NEAREST_RAILROAD:
+			this->landOn(player, lane, this->nearest_railroad_[location]);
+			break;
+		case Card::MOVE_TO_NEAREST_UTILITY:
+			this->landOn(player, lane, this->nearest_utility_[location]);
+			break;
+		case Card::GO_TO_JAIL:
+			this->arrestPlayer(player, lane);
+			break;
+		default:
+			//No-op
+			break;
+	}
+	//Return the card to the back of the deck
+	cards[(cursor.head() + cursor.size()) % size] = id;
+	cursor.push();
+}
+
+/**
+ * Shuffles the cards left in a lane's deck, exactly as Simulator::shuffleDeck()
+ * does, and counts them as undrawn. The deck is laid out again from slot 0.
+ */
+void BatchSimulator::shuffleDeck(CardDecks::Deck deck, int lane) {
+	DeckCursor& cursor = this->deck_cursors_[deck][lane];
+	int size = this->definition_->deckSize(deck);
+	int count = cursor.size();
+	unsigned char* cards = &this->deck_cards_[deck][lane * CardDecks::MAXIMUM_DECK_SIZE];
+	unsigned char ids[CardDecks::MAXIMUM_DECK_SIZE];
+	for(int c = 0; c < count; c++) {
+		ids[c] = cards[(cursor.head() + c) % size];
+	}
+	this->deck_shuffles_[deck][lane].shuffle(ids, count);
+	for(int c = 0; c < count; c++) {
+		cards[c] = ids[c];
+	}
+	cursor.reset(count);
+}
+
+/* Returns a held 'Get Out of Jail Free' card to its deck and frees the Player */
+void BatchSimulator::useGetOutOfJailCard(int player, int lane) {
+	PlayerState& state = this->players_[player * LANES + lane];
+	CardDecks::Deck deck = state.hasGetOutOfJailCard(CardDecks::CHANCE_DECK) ? CardDecks::CHANCE_DECK : CardDecks::COMMUNITY_CHEST_DECK;
+	state.setGetOutOfJailCard(deck, false);
+	state.setDetention(false);
+	//Return the card to the back of the deck
+	DeckCursor& cursor = this->deck_cursors_[deck][lane];
+	int size = this->definition_->deckSize(deck);
+	unsigned char* cards = &this->deck_cards_[deck][lane * CardDecks::MAXIMUM_DECK_SIZE];
+	cards[(cursor.head() + cursor.size()) % size] = this->definition_->keptCard(deck);
+	cursor.push();
+}
@@ -0,0 +1,137 @@
+/**
+ * @file BatchSimulator.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Describes the public interface and private methods of the BatchSimulator class.
+ * Where the Simulator plays out a single game one Player at a time, the
+ * BatchSimulator advances many independent games in lockstep. Games are processed
+ * in blocks of LANES games; within a block, the state of every game is stored as a
+ * set of parallel arrays (one element per game, or 'lane'), so that each phase of
+ * a turn (rolling, moving, jailing) is a tight, branch-free loop over all lanes
+ * that the compiler can vectorize. Only the rare events (drawing a card, using a
+ * 'Get Out of Jail Free' card) are resolved lane by lane.
+ *
+ * The rules of play are exactly those of Simulator::simulateTurn(), and landing
+ * counts are reported in the same format as Simulator::printPropertyStatistics().
+ * Game k rolls from the same random streams as a Simulator run of game k, so the
+ * two engines produce identical results for a given seed. The MonteCarloRunner
+ * spreads a BatchSimulator's work across threads.
+ *
+ * Lanes need not share a seed: simulateGames() also accepts a list of (seed, game)
+ * pairs, and can report the landing counts of each game separately. The
+ * SweepRunner uses this to fill every lane with a different point of its sweep,
+ * and reconfigure() to move a BatchSimulator on to the next player and turn count
+ * without rebuilding its tables.
+ *
+ * The lookup tables (tile kinds, 'nearest' jump targets and decks) are taken from
+ * the configured BoardDefinition, so any board is played by the same loops; only
+ * the board's size and Jail are read at run time.
+ *
+ * Each Player's lane state is a packed PlayerState, and each deck's position a
+ * DeckCursor (see 'GameState.h'), so a block's games stay resident in cache
+ * however many Players each has; the turn loops unpack a lane's state into
+ * locals, resolve the roll and pack it back.
+ *
+ * A RoundCallback, if one is set, is given the running totals after every round.
+ * The lane counters are then flushed every round rather than every FLUSH_INTERVAL
+ * rounds; when more than LANES games are simulated, each block of games reports
+ * its rounds in turn, on top of the totals of the blocks before it.
+ */
+
+#ifndef BATCH_SIMULATOR_H
+#define BATCH_SIMULATOR_H
+
+//Protected includes (for arguments and return types)
+#include <ostream>
+#include <vector>
+#include "SimulatorConfig.h"
+#include "Board.h"
+#include "BoardDefinition.h"
+#include "CardDecks.h"
+#include "Dice.h"
+#include "Shuffle.h"
+#include "GameState.h"
+
+class BatchSimulator {
+
+public:
+
+	//Number of games advanced in lockstep
+	static const int LANES = 256;
+
+	/* A game to simulate: the seed of its random streams, and its index among the seed's games */
+	struct Game {
+		unsigned long long seed;
+		int index;
+	};
+
+	/* Called after every round with the round's index, the landing totals so far, and the caller's data */
+	typedef void (*RoundCallback)(int round, const unsigned long long* counts, void* user_data);
+
+	//BatchSimulator class constructor
+	BatchSimulator(SimulatorConfig config);
+	//BatchSimulator class destructor
+	~BatchSimulator();
+
+	void reconfigure(SimulatorConfig config);
+	void setRoundCallback(RoundCallback callback, void* user_data);
+	void simulateGames(int first_game, int game_count);
+	void simulateGames(const Game* games, int game_count, unsigned long long* game_counts = NULL);
+
+	//Accessor methods
+	unsigned long long landingCount(int n) const;
+	void printPropertyStatistics(ostream& output) const;
+
+private:
+
+	/*** Private member variables ***/
+
+	//Configuration and board tables
+	SimulatorConfig config_;
+	unsigned long long seed_;
+	shared_ptr<const BoardDefinition> definition_;
+	int board_size_;
+	int jail_location_;
+	unsigned char kind_[Board::MAXIMUM_SIZE];
+	signed char nearest_railroad_[Board::MAXIMUM_SIZE];
+	signed char nearest_utility_[Board::MAXIMUM_SIZE];
+
+	//Per-Player lane state, indexed by [player * LANES + lane]
+	vector<PlayerState> players_;
+	vector<DiceStream> dice_;
+
+	//Per-game lane state
+	vector<unsigned char> deck_cards_[CardDecks::DECK_COUNT]; //[lane * MAXIMUM_DECK_SIZE + slot]
+	vector<DeckCursor> deck_cursors_[CardDecks::DECK_COUNT];
+	vector<ShuffleStream> deck_shuffles_[CardDecks::DECK_COUNT];
+	vector<unsigned char> die1_;
+	vector<unsigned char> die2_;
+	vector<unsigned char> active_;
+	vector<unsigned char> moved_;
+
+	//Landing counters, per lane ([tile * LANES + lane]) and in total
+	vector<unsigned int> lane_counts_;
+	unsigned long long counts_[Board::MAXIMUM_SIZE];
+
+	//Optional per-round report of the totals
+	RoundCallback round_callback_;
+	void* round_user_data_;
+
+	/*** Private method implementation ***/
+
+	void resetLanes(const Game* games, int lanes);
+	void simulateTurns(int player, int lanes);
+	void flushCounts(int lanes, unsigned long long* game_counts);
+
+	int getDiceRoll(int player, int lane);
+
+	void landOn(int player, int lane, int index);
+	void arrestPlayer(int player, int lane);
+	void drawCard(CardDecks::Deck deck, int player, int lane);
+	void shuffleDeck(CardDecks::Deck deck, int lane);
+	void useGetOutOfJailCard(int player, int lane);
+
+};
+
+#endif
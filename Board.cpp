@@ -12,76 +12,41 @@
 #include <string>
 #include <vector>
 #include <stdexcept>
-#include "lib/Queue.h"
 #include "Property.h"
 
 //Header include
 #include "Board.h"
 
-/*** Public interface implementation ***/
+//Class dependencies
+#include "BoardDefinition.h"
 
-/**
- * Takes a Property index that may reside outside of the valid index range
- * and returns a valid index. Invali"d indices will be 'wrapped' around
- * into a valid range (supports forward wrapping and backward wrapping).
- * 
- * See http://stackoverflow.com/questions/707370
- *	
- * @param 	n 	A board index
- */
-int Board::wrapIndex(int n, int lower_bound, int upper_bound) {
-	int range_size = upper_bound - lower_bound + 1; //40, by default
-	if(n < lower_bound) {
-		//If the provided index falls below the lower_bound, bump it forward by
-		//range_size until it falls within the valid range
-		int lower_delta = lower_bound - n;
-		//Integer division (if the index is between (lower_bound - lower_bound,
-		//lower_bound], it will return zero. That's why we add 1 afterward
-		int ranges_between = lower_delta / range_size + 1;
-		n += range_size * ranges_between;
-	}
-	return lower_bound + (n - lower_bound) % range_size;
-}
+/*** Public interface implementation ***/
 
 //Board class constructor
-Board::Board() { }
+Board::Board() : size_(0), jail_location_(-1) { }
 
-//Board class destructor
-Board::~Board() {
-	for(unsigned int i = 0; i < this->board_.size(); i++) {
-		delete this->board_.at(i);
-	}
-}
+//Board class destructor (the Properties are released with the Board's arena)
+Board::~Board() { }
 
 /**
  * Returns the board_ index of a given Property. Throws an invalid_argument
- * exception if no match is found in the Board.
+ * exception if no match is found in the Board. This is a linear scan; the
+ * Simulator tracks Players by index and never needs to call it.
  *
  * @param 	property 	A reference to a Property object
  */
 int Board::indexOf(Property& property) const {
-	for(unsigned int i = 0; i < this->board_.size(); i++) {
+	for(int i = 0; i < this->size_; i++) {
 		//Because certain properties can hold the same name (e.g. - "Chance"),
 		//and we aren't giving each Property a unique id property, we'll just
 		//test for identity (location in memory)
-		if(&property == this->board_.at(i)) {
+		if(&property == this->board_[i]) {
 			return i;
 		}
 	}
 	throw invalid_argument("This Property does no exist on the Board!");
 }
 
-/**
- * Returns a reference to the Property object that corresponds with a
- * give index. Supports 'wrapping' of all out-of-bounds indices, including
- * negative indices.
- *
- * @param 	n 	A Property index
- */
-Property& Board::propertyAt(int n) const {
-	return *(this->board_.at(Board::wrapIndex(n)));
-} 	
-
 /**
  * Alternate implementation of propertyAt which allows the user to specify
  * a Property relative to a given Property. The offset value may be either
@@ -92,12 +57,39 @@ Property& Board::propertyAt(int n) const {
  */
 Property& Board::propertyAt(Property& property, int offset) const {
 	int index = this->indexOf(property); //May throw an exception
-	return *(this->board_.at(Board::wrapIndex(index + offset)));
+	return this->propertyAt(index + offset);
+}
+
+/**
+ * Creates a new Property at the end of the Board and returns a reference to
+ * it. The Property is allocated from the Board's arena, and lives as long as
+ * the Board. Throws a length_error once all MAXIMUM_SIZE slots are taken.
+ *
+ * @param 	name 	The name of the new Property, which must outlive the Board
+ * @param 	kind 	The kind of the new Property
+ */
+Property& Board::addProperty(const char* name, Property::Kind kind) {
+	if(this->size_ >= Board::MAXIMUM_SIZE) {
+		throw length_error("The Board is full!");
+	}
+	if(kind == Property::JAIL && this->jail_location_ == -1) {
+		this->jail_location_ = this->size_;
+	}
+	Property* property = this->arena_.create<Property>(name, kind);
+	this->board_[this->size_++] = property;
+	return *property;
+}
+
+/* Populates an empty Board with the Properties of a BoardDefinition, in order */
+void Board::populate(const BoardDefinition& definition) {
+	for(int i = 0; i < definition.size(); i++) {
+		this->addProperty(definition.tileName(i), definition.kind(i));
+	}
 }
 
-void Board::addProperty(Property& property) {
-	//Push a pointer to the referenced Property object
-	this->board_.push(&property);
+/* Populates an empty Board with the Properties of a classic Monopoly board */
+void Board::populateClassic() {
+	this->populate(*BoardDefinition::classic());
 }
 
 /*** Private method implementation ***/
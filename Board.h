@@ -8,40 +8,116 @@
  * 2008 Monopoly board. Each Property stores a name, a counter for the number of times
  * that the property has been landed on, and an action (response) to fire each time
  * that a player lands on the Property.
+ *
+ * A Board is populated from a BoardDefinition (see 'BoardDefinition.h'), so its
+ * size is only known at run time, up to MAXIMUM_SIZE; BOARD_SIZE and JAIL_LOCATION
+ * describe the classic board. Code that may be handed any Board wraps indices with
+ * wrap() and finds the Jail with jailLocation().
+ *
+ * Properties are kept in a fixed-capacity, contiguous table so that a Property can be
+ * found from its index in constant time. Since a Player's location is already a
+ * Board index, the simulation never needs to search the Board for a Property.
+ * The Properties themselves are allocated from an Arena owned by the Board, and
+ * are all released together with it. Their names are not copied, so a populated
+ * Board must not outlive its BoardDefinition.
  */
 
 #ifndef BOARD_H
 #define BOARD_H
 
 //Protected includes (for arguments and return types)
-#include "lib/Queue.h"
+#include <stdexcept>
+#include <string>
 #include "Property.h"
+#include "GameState.h"
+#include "lib/Arena.h"
+
+//Forward declaration
+class BoardDefinition;
 
 class Board {
 
 public:
 
+	//The classic board's size and Jail, and the most Properties that any Board may hold
 	static const int BOARD_SIZE = 40;
 	static const int JAIL_LOCATION = 10;
-	
+	static const int MAXIMUM_SIZE = 64;
+
 	static int wrapIndex(int n, int lower_bound = 0, int upper_bound = Board::BOARD_SIZE - 1);
 
 	Board();
 	~Board();
 
  	//Accessor methods
+	int size() const { return this->size_; }
+	/* Returns the index of the (first) Jail, or -1 if the Board has none */
+	int jailLocation() const { return this->jail_location_; }
+	int wrap(int n) const { return Board::wrapIndex(n, 0, this->size_ - 1); }
 	int indexOf(Property& property) const;
 	Property& propertyAt(int n) const;
 	Property& propertyAt(Property& property, int n) const;
 
 	//Mutator methods
-	void addProperty(Property& property);
+	Property& addProperty(const char* name, Property::Kind kind = Property::PLAIN);
+	void populate(const BoardDefinition& definition);
+	void populateClassic();
 
 private:
 
-	Queue<Property*> board_;
-	
+	Arena arena_;
+	Property* board_[MAXIMUM_SIZE];
+	int size_;
+	int jail_location_;
+
 };
 
-#endif
+//Every location must fit in a packed PlayerState
+static_assert(Board::MAXIMUM_SIZE <= PlayerState::LOCATION_COUNT, "A Board holds more locations than a PlayerState can");
+
+/*** Inline implementation (called on every Player move) ***/
 
+/**
+ * Takes a Property index that may reside outside of the valid index range
+ * and returns a valid index. Invalid indices will be 'wrapped' around
+ * into a valid range (supports forward wrapping and backward wrapping).
+ *
+ * See http://stackoverflow.com/questions/707370
+ *
+ * @param 	n 	A board index
+ */
+inline int Board::wrapIndex(int n, int lower_bound, int upper_bound) {
+	//Most indices handed to us are already valid (or only one lap out), so
+	//skip the division in the common case
+	if(n >= lower_bound && n <= upper_bound) {
+		return n;
+	}
+	int range_size = upper_bound - lower_bound + 1; //40, by default
+	if(n < lower_bound) {
+		//If the provided index falls below the lower_bound, bump it forward by
+		//range_size until it falls within the valid range
+		int lower_delta = lower_bound - n;
+		//Integer division (if the index is between (lower_bound - lower_bound,
+		//lower_bound], it will return zero. That's why we add 1 afterward
+		int ranges_between = lower_delta / range_size + 1;
+		n += range_size * ranges_between;
+	}
+	return lower_bound + (n - lower_bound) % range_size;
+}
+
+/**
+ * Returns a reference to the Property object that corresponds with a
+ * give index. Supports 'wrapping' of all out-of-bounds indices, including
+ * negative indices, around the Properties added so far. Throws a length_error
+ * if the Board is empty.
+ *
+ * @param 	n 	A Property index
+ */
+inline Property& Board::propertyAt(int n) const {
+	if(this->size_ == 0) {
+		throw length_error("The given index is out-of-bounds!");
+	}
+	return *(this->board_[this->wrap(n)]);
+}
+
+#endif
@@ -0,0 +1,300 @@
+/**
+ * @file BoardDefinition.cpp
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Contains implementation of the public interface and private methods of
+ * the BoardDefinition class. For details about this class, see 'BoardDefinition.h'.
+ */
+
+//Protected includes
+#include <cstring>
+#include <fstream>
+#include <istream>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+//Class header include
+#include "BoardDefinition.h"
+
+//Class dependencies
+#include "Board.h"
+#include "Property.h"
+#include "Card.h"
+#include "CardDecks.h"
+#include "ClassicBoard.h"
+#include "BoardTables.h"
+
+using namespace std;
+
+//The classic tables and the engines' Board constants must agree
+static_assert(ClassicBoard::SIZE == Board::BOARD_SIZE, "The classic board isn't BOARD_SIZE tiles long");
+static_assert(ClassicBoard::JAIL_LOCATION == Board::JAIL_LOCATION, "The classic Jail isn't at JAIL_LOCATION");
+
+//Keywords of a definition file, indexed by Property::Kind and Card::Effect
+static const char* KIND_NAMES[] = { "plain", "railroad", "utility", "chance", "community_chest", "go_to_jail", "jail" };
+static const char* EFFECT_NAMES[] = { "none", "move_to", "move_by", "nearest_railroad", "nearest_utility", "go_to_jail", "keep" };
+//Each deck's name in error messages, indexed by CardDecks::Deck
+static const char* DECK_NAMES[] = { "Chance", "Community Chest" };
+
+/* Removes leading and trailing whitespace */
+static string trim(const string& text) {
+	size_t first = text.find_first_not_of(" \t\r");
+	if(first == string::npos) {
+		return "";
+	}
+	return text.substr(first, text.find_last_not_of(" \t\r") - first + 1);
+}
+
+/*** Public interface implementation ***/
+
+/**
+ * Returns the built-in classic board, whose tables are laid out in 'ClassicBoard.h'
+ * and 'CardDecks.h'. The definition lives as long as the program, so it is shared
+ * without a reference count, and no call (nor copy of the pointer) allocates.
+ */
+shared_ptr<const BoardDefinition> BoardDefinition::classic() {
+	static const BoardDefinition classic;
+	return shared_ptr<const BoardDefinition>(shared_ptr<const BoardDefinition>(), &classic);
+}
+
+/**
+ * Reads a definition file. Throws a runtime_error if the file can't be opened,
+ * and an invalid_argument exception if it doesn't describe a playable board.
+ *
+ * @param 	path 	The path of the definition file
+ */
+shared_ptr<const BoardDefinition> BoardDefinition::load(const string& path) {
+	ifstream input(path.c_str());
+	if(!input.is_open()) {
+		throw runtime_error("Exception occured when opening a file for reading.\n\n");
+	}
+	return BoardDefinition::parse(input, path);
+}
+
+/**
+ * Reads a definition (see 'BoardDefinition.h') and compiles it. Throws an
+ * invalid_argument exception, naming the source and line, if it is malformed or
+ * doesn't describe a playable board.
+ *
+ * @param 	input 	The definition's text
+ * @param 	source 	Where the text came from, for error messages
+ */
+shared_ptr<const BoardDefinition> BoardDefinition::parse(istream& input, const string& source) {
+	shared_ptr<BoardDefinition> definition(new BoardDefinition(source));
+	string line;
+	for(int number = 1; getline(input, line); number++) {
+		try {
+			line = trim(line.substr(0, line.find('#')));
+			if(line.empty()) {
+				continue;
+			}
+			size_t space = line.find_first_of(" \t");
+			string keyword = line.substr(0, space);
+			string rest = (space == string::npos) ? "" : trim(line.substr(space));
+			//Split the entry into its text and its kind or effect
+			size_t bar = rest.find('|');
+			string text = trim(rest.substr(0, bar));
+			istringstream detail((bar == string::npos) ? "" : rest.substr(bar + 1));
+			string type;
+			detail >> type;
+			if(text.empty()) {
+				throw invalid_argument("A name or description is missing!");
+			}
+			if(keyword == "name") {
+				definition->name_ = rest;
+			} else
+			if(keyword == "tile") {
+				int kind = 0;
+				while(!type.empty() && kind < (int)(sizeof(KIND_NAMES) / sizeof(char*)) && type != KIND_NAMES[kind]) {
+					kind++;
+				}
+				if(kind == (int)(sizeof(KIND_NAMES) / sizeof(char*))) {
+					throw invalid_argument("Unknown tile kind: " + type);
+				}
+				definition->addTile(text, (Property::Kind)kind);
+			} else
+			if(keyword == "chance" || keyword == "community_chest") {
+				int effect = 0;
+				while(!type.empty() && effect < (int)(sizeof(EFFECT_NAMES) / sizeof(char*)) && type != EFFECT_NAMES[effect]) {
+					effect++;
+				}
+				if(effect == (int)(sizeof(EFFECT_NAMES) / sizeof(char*))) {
+					throw invalid_argument("Unknown card effect: " + type);
+				}
+				int argument = 0;
+				if(effect == Card::MOVE_TO || effect == Card::MOVE_BY) {
+					if(!(detail >> argument)) {
+						throw invalid_argument("The card's effect needs a number!");
+					}
+				}
+				CardDecks::Deck deck = (keyword == "chance") ? CardDecks::CHANCE_DECK : CardDecks::COMMUNITY_CHEST_DECK;
+				definition->addCard(deck, text, (Card::Effect)effect, argument);
+			} else {
+				throw invalid_argument("Unknown entry: " + keyword);
+			}
+			if(detail >> type) {
+				throw invalid_argument("Unexpected text: " + type);
+			}
+		} catch(const exception& e) {
+			ostringstream message;
+			message << source << ":" << number << ": " << e.what();
+			throw invalid_argument(message.str());
+		}
+	}
+	try {
+		definition->compile();
+	} catch(const exception& e) {
+		throw invalid_argument(source + ": " + e.what());
+	}
+	return shared_ptr<const BoardDefinition>(definition);
+}
+
+/**
+ * Returns a 64-bit FNV-1a hash of everything that play depends on: each tile's
+ * kind and name, and each deck's cards (their effects, arguments and descriptions,
+ * in order). Two definitions with the same fingerprint play the same games, so a
+ * checkpoint records it to refuse being resumed on a different board; the board's
+ * name is left out, as it changes nothing.
+ */
+unsigned long long BoardDefinition::fingerprint() const {
+	unsigned long long hash = 14695981039346656037ull;
+	auto mix = [&hash](long long value) {
+		for(int b = 0; b < 8; b++) {
+			hash = (hash ^ ((unsigned long long)value >> (8 * b) & 0xff)) * 1099511628211ull;
+		}
+	};
+	auto mixString = [&mix](const char* text) {
+		for(; *text != '\0'; text++) {
+			mix((unsigned char)*text);
+		}
+		mix(-1);
+	};
+	mix(this->size_);
+	for(int i = 0; i < this->size_; i++) {
+		mix(this->kinds_[i]);
+		mixString(this->names_[i]);
+	}
+	for(int d = 0; d < CardDecks::DECK_COUNT; d++) {
+		mix(this->deck_size_[d]);
+		for(int id = 0; id < this->deck_size_[d]; id++) {
+			const Card& card = this->cards_[d][id];
+			mix(card.effect());
+			mix(card.argument());
+			mixString(card.description());
+		}
+	}
+	return hash;
+}
+
+/*** Private method implementation ***/
+
+/* BoardDefinition class constructor. Points the tables at the classic board's. */
+BoardDefinition::BoardDefinition()
+: name_("Classic"), size_(ClassicBoard::SIZE), names_(ClassicBoard::NAMES.at), kinds_(ClassicBoard::KINDS.at),
+  jail_location_(ClassicBoard::JAIL_LOCATION), nearest_railroad_(ClassicBoard::NEAREST_RAILROAD.at),
+  nearest_utility_(ClassicBoard::NEAREST_UTILITY.at) {
+	for(int d = 0; d < CardDecks::DECK_COUNT; d++) {
+		this->cards_[d] = CardDecks::CARDS[d];
+		this->deck_size_[d] = CardDecks::SIZE[d];
+		this->kept_card_[d] = CardDecks::KEPT_CARD[d];
+	}
+}
+
+/* BoardDefinition class constructor. Creates an empty definition, to be filled from a file. */
+BoardDefinition::BoardDefinition(const string& name)
+: name_(name), size_(0), names_(this->tile_names_), kinds_(this->tile_kinds_), jail_location_(-1),
+  nearest_railroad_(this->railroad_targets_), nearest_utility_(this->utility_targets_) {
+	for(int d = 0; d < CardDecks::DECK_COUNT; d++) {
+		this->cards_[d] = NULL;
+		this->deck_size_[d] = 0;
+		this->kept_card_[d] = -1;
+	}
+}
+
+/* Copies a string into the definition, and returns the copy */
+const char* BoardDefinition::store(const string& text) {
+	char* copy = (char*)this->strings_.allocate(text.size() + 1, 1);
+	memcpy(copy, text.c_str(), text.size() + 1);
+	return copy;
+}
+
+/* Adds a tile at the end of the board */
+void BoardDefinition::addTile(const string& name, Property::Kind kind) {
+	if(this->size_ >= Board::MAXIMUM_SIZE) {
+		throw length_error("The board holds more tiles than Board::MAXIMUM_SIZE!");
+	}
+	this->tile_kinds_[this->size_] = kind;
+	this->tile_names_[this->size_] = this->store(name);
+	this->size_++;
+}
+
+/* Adds a card at the bottom of a deck */
+void BoardDefinition::addCard(CardDecks::Deck deck, const string& description, Card::Effect effect, int argument) {
+	if(this->deckSize(deck) >= CardDecks::MAXIMUM_DECK_SIZE) {
+		throw length_error("A deck holds more cards than CardDecks::MAXIMUM_DECK_SIZE!");
+	}
+	if(effect == Card::KEEP_CARD) {
+		if(this->kept_card_[deck] != -1) {
+			throw invalid_argument("A deck may hold only one 'Get Out of Jail Free' card!");
+		}
+		this->kept_card_[deck] = this->deckSize(deck);
+	}
+	this->deck_cards_[deck].push_back(Card(this->store(description), effect, argument));
+	this->cards_[deck] = this->deck_cards_[deck].data();
+	this->deck_size_[deck]++;
+}
+
+/**
+ * Checks that the definition describes a playable board, and fills in the
+ * tables that are derived from the tiles. Throws an invalid_argument exception
+ * describing the first problem found.
+ */
+void BoardDefinition::compile() {
+	int size = this->size();
+	if(size < MINIMUM_SIZE) {
+		throw invalid_argument("The board holds fewer tiles than BoardDefinition::MINIMUM_SIZE!");
+	}
+	//The Jail, and the nearest Railroad and Utility ahead of each tile
+	bool has_kind[sizeof(KIND_NAMES) / sizeof(char*)] = { false };
+	for(int i = 0; i < size; i++) {
+		has_kind[this->tile_kinds_[i]] = true;
+		if(this->tile_kinds_[i] == Property::JAIL && this->jail_location_ == -1) {
+			this->jail_location_ = i;
+		}
+	}
+	if(this->jail_location_ == -1) {
+		throw invalid_argument("The board has no Jail!");
+	}
+	for(int i = 0; i < size; i++) {
+		this->railroad_targets_[i] = BoardTables::nearest(this->tile_kinds_, size, i, Property::RAILROAD);
+		this->utility_targets_[i] = BoardTables::nearest(this->tile_kinds_, size, i, Property::UTILITY);
+	}
+	//Every card must lead somewhere on this board
+	for(int d = 0; d < CardDecks::DECK_COUNT; d++) {
+		for(int id = 0; id < this->deckSize((CardDecks::Deck)d); id++) {
+			const Card& card = this->deck_cards_[d][id];
+			if(card.effect() == Card::MOVE_TO && (card.argument() < 0 || card.argument() >= size)) {
+				throw invalid_argument(string("A card moves to a tile that doesn't exist: ") + card.description());
+			}
+			if(card.effect() == Card::MOVE_TO_NEAREST_RAILROAD && !has_kind[Property::RAILROAD]) {
+				throw invalid_argument("A card moves to the nearest Railroad, but the board has none!");
+			}
+			if(card.effect() == Card::MOVE_TO_NEAREST_UTILITY && !has_kind[Property::UTILITY]) {
+				throw invalid_argument("A card moves to the nearest Utility, but the board has none!");
+			}
+		}
+	}
+	//A deck must never run dry, even while its kept card is held and a chain of
+	//cards (each moving the Player onto another of its tiles) is being followed
+	for(int d = 0; d < CardDecks::DECK_COUNT; d++) {
+		int kept = (this->kept_card_[d] == -1) ? 0 : 1;
+		if(has_kind[BoardTables::drawTile(d)] &&
+		   BoardTables::chainedDraws(this->tile_kinds_, size, this->cards_, this->deck_size_, d) > this->deck_size_[d] - kept) {
+			throw invalid_argument(string("The board has ") + DECK_NAMES[d] + " tiles, but a chain of cards can draw more " +
+								   DECK_NAMES[d] + " cards than the deck holds!");
+		}
+	}
+}
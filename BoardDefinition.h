@@ -0,0 +1,125 @@
+/**
+ * @file BoardDefinition.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Describes the public interface and private methods of the BoardDefinition class.
+ * A BoardDefinition is the layout that a game is played on: its Properties (each
+ * with a name and a kind) and the contents of its Chance and Community Chest decks.
+ * The classic board is built in; other boards (the UK board, tournament boards of
+ * other sizes, and so on) are read from definition files, such as those under
+ * 'boards/'. A definition file is plain text, one entry per line:
+ *
+ * 		# Comments and blank lines are ignored
+ * 		name UK
+ * 		tile Go
+ * 		tile Community Chest | community_chest
+ * 		tile In Jail/Just Visiting | jail
+ * 		chance Advance to Go | move_to 0
+ * 		chance Go back 3 spaces | move_by -3
+ * 		community_chest Get Out of Jail Free | keep
+ *
+ * Tiles are laid out in the order given, starting from 'Go'. A tile's kind is one of
+ * plain (the default), railroad, utility, chance, community_chest, go_to_jail and
+ * jail; a card's effect is one of none (the default), move_to N, move_by N,
+ * nearest_railroad, nearest_utility, go_to_jail and keep. Cards are stacked in the
+ * order given.
+ *
+ * Once read, a definition is checked and compiled into flat tables that the engines
+ * index directly: each tile's name and kind, the Jail's index, the nearest Railroad
+ * and Utility ahead of each tile, and each deck's Cards and kept card. The classic
+ * board's tables are constexpr data (see 'ClassicBoard.h' and 'CardDecks.h'), so
+ * classic() builds nothing: it allocates no memory and copies no strings. Definitions
+ * are immutable, and shared (see SimulatorConfig::board()) rather than copied.
+ */
+
+#ifndef BOARD_DEFINITION_H
+#define BOARD_DEFINITION_H
+
+//Protected includes
+#include <istream>
+#include <memory>
+#include <string>
+#include <vector>
+#include "Board.h"
+#include "Property.h"
+#include "Card.h"
+#include "CardDecks.h"
+#include "lib/Arena.h"
+
+using namespace std;
+
+class BoardDefinition {
+
+public:
+
+	//A Board must be long enough that no roll (at most 12) laps it
+	static const int MINIMUM_SIZE = 12;
+
+	/*** Public interface implementation ***/
+
+	//Factories
+
+	static shared_ptr<const BoardDefinition> classic();
+	static shared_ptr<const BoardDefinition> load(const string& path);
+	static shared_ptr<const BoardDefinition> parse(istream& input, const string& source);
+
+	//Accessor methods
+
+	const string& name() const { return this->name_; }
+	int size() const { return this->size_; }
+	const char* tileName(int n) const { return this->names_[n]; }
+	Property::Kind kind(int n) const { return (Property::Kind)this->kinds_[n]; }
+	int jailLocation() const { return this->jail_location_; }
+
+	/* Returns the index of the first Railroad (or Utility) ahead of tile n, or -1 if there is none */
+	int nearestRailroad(int n) const { return this->nearest_railroad_[n]; }
+	int nearestUtility(int n) const { return this->nearest_utility_[n]; }
+
+	int deckSize(CardDecks::Deck deck) const { return this->deck_size_[deck]; }
+	const Card& card(CardDecks::Deck deck, int id) const { return this->cards_[deck][id]; }
+	/* Returns the id of a deck's 'Get Out of Jail Free' card, or -1 if it has none */
+	int keptCard(CardDecks::Deck deck) const { return this->kept_card_[deck]; }
+	unsigned long long fingerprint() const;
+
+	BoardDefinition(const BoardDefinition&) = delete;
+	BoardDefinition& operator=(const BoardDefinition&) = delete;
+
+private:
+
+	/*** Private member variables ***/
+
+	string name_;
+	int size_;
+
+	//Tables that the accessors read; the classic board's are constexpr, the rest point below
+	const char* const* names_;
+	const unsigned char* kinds_;
+	int jail_location_;
+	const signed char* nearest_railroad_;
+	const signed char* nearest_utility_;
+	const Card* cards_[CardDecks::DECK_COUNT];
+	int deck_size_[CardDecks::DECK_COUNT];
+	int kept_card_[CardDecks::DECK_COUNT];
+
+	//Tables of a definition read from a file; strings_ owns its names and descriptions
+	const char* tile_names_[Board::MAXIMUM_SIZE];
+	unsigned char tile_kinds_[Board::MAXIMUM_SIZE];
+	signed char railroad_targets_[Board::MAXIMUM_SIZE];
+	signed char utility_targets_[Board::MAXIMUM_SIZE];
+	vector<Card> deck_cards_[CardDecks::DECK_COUNT];
+	Arena strings_;
+
+	/*** Private method implementation ***/
+
+	BoardDefinition();
+	BoardDefinition(const string& name);
+
+	const char* store(const string& text);
+	void addTile(const string& name, Property::Kind kind);
+	void addCard(CardDecks::Deck deck, const string& description, Card::Effect effect, int argument);
+	void compile();
+
+};
+
+#endif
@@ -0,0 +1,99 @@
+/**
+ * @file BoardTables.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Implements the constexpr helpers that derive a board's lookup tables from its
+ * tiles. ClassicBoard computes the classic board's tables with them at compile
+ * time, and BoardDefinition::compile() computes a loaded board's at run time, so
+ * both kinds of board are laid out (and checked) by the same code.
+ */
+
+#ifndef BOARD_TABLES_H
+#define BOARD_TABLES_H
+
+//Protected includes
+#include "Property.h"
+#include "Card.h"
+#include "CardDecks.h"
+
+namespace BoardTables {
+
+	/**
+	 * Returns the index of the first tile of the given kind that lies ahead of
+	 * tile 'from', moving forward around the board (wrapping back to 'from'
+	 * itself), or -1 if the board has no such tile.
+	 *
+	 * @param 	kinds 	Each tile's Property::Kind, indexed by Board location
+	 * @param 	size 	The number of tiles on the board
+	 * @param 	from 	The index of the tile to start from
+	 * @param 	kind 	The kind of tile to look for
+	 */
+	constexpr int nearest(const unsigned char* kinds, int size, int from, Property::Kind kind) {
+		for(int offset = 1; offset <= size; offset++) {
+			int index = (from + offset) % size;
+			if(kinds[index] == kind) {
+				return index;
+			}
+		}
+		return -1;
+	}
+
+	/* Returns the kind of tile that draws from the given deck */
+	constexpr Property::Kind drawTile(int deck) {
+		return (deck == CardDecks::CHANCE_DECK) ? Property::CHANCE : Property::COMMUNITY_CHEST;
+	}
+
+	/**
+	 * Returns whether a card can move a Player onto a tile of the given kind. A
+	 * card is only ever followed from a tile of its own deck, so a relative move
+	 * is tried from each of those.
+	 *
+	 * @param 	kinds 	Each tile's Property::Kind, indexed by Board location
+	 * @param 	size 	The number of tiles on the board
+	 * @param 	card 	The card
+	 * @param 	deck 	The card's deck
+	 * @param 	kind 	The kind of tile to reach
+	 */
+	constexpr bool reaches(const unsigned char* kinds, int size, const Card& card, int deck, Property::Kind kind) {
+		if(card.effect() == Card::MOVE_TO) {
+			return kinds[card.argument()] == kind;
+		}
+		if(card.effect() == Card::MOVE_BY) {
+			for(int from = 0; from < size; from++) {
+				int to = ((from + card.argument()) % size + size) % size;
+				if(kinds[from] == drawTile(deck) && kinds[to] == kind) {
+					return true;
+				}
+			}
+		}
+		return false;
+	}
+
+	/**
+	 * Returns the most cards that a chain of draws can take out of a deck at once.
+	 * A card stays out of its deck while it is followed, and a card that moves the
+	 * Player onto another Chance or Community Chest tile draws again before it is
+	 * returned, so each such card that reaches the deck's tiles may add one more.
+	 * The deck must hold that many cards besides its kept card, which may be held.
+	 *
+	 * @param 	kinds 			Each tile's Property::Kind, indexed by Board location
+	 * @param 	size 			The number of tiles on the board
+	 * @param 	cards 			Each deck's cards, indexed by CardDecks::Deck
+	 * @param 	deck_sizes 		Each deck's number of cards
+	 * @param 	deck 			The deck to count draws from
+	 */
+	constexpr int chainedDraws(const unsigned char* kinds, int size, const Card* const* cards,
+							   const int* deck_sizes, int deck) {
+		int draws = 1;
+		for(int d = 0; d < CardDecks::DECK_COUNT; d++) {
+			for(int id = 0; id < deck_sizes[d]; id++) {
+				draws += reaches(kinds, size, cards[d][id], d, drawTile(deck)) ? 1 : 0;
+			}
+		}
+		return draws;
+	}
+
+};
+
+#endif
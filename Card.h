@@ -5,17 +5,12 @@
  *
  * Describes the protected methods and private methods of the Card class.
  * This class is used to represent a single stateless Card which has a
- * description and an action function.
+ * description and an effect. Rather than calling out to an action function,
+ * each Card names its effect from a small, fixed set (see Card::Effect), along
+ * with the effect's argument. Cards are literal types, so whole decks can be
+ * laid out as constexpr tables (see 'CardDecks.h') and followed with a switch.
  */
 
-//Protected includes
-#include <string>
-
-//Forward declarations of class dependencies
-class Simulator;
-class Player;
-class Board;
-
 #ifndef CARD_H
 #define CARD_H
 
@@ -23,27 +18,32 @@ class Card {
 
 public:
 
-	typedef void (*CardAction) (Simulator& simulator, Player& player);
+	//Card effects
+	enum Effect {
+		NO_EFFECT,
+		MOVE_TO, 					//Advance to the Property at index 'argument'
+		MOVE_BY, 					//Move 'argument' spaces (backward, if negative)
+		MOVE_TO_NEAREST_RAILROAD,
+		MOVE_TO_NEAREST_UTILITY,
+		GO_TO_JAIL,
+		KEEP_CARD 					//Held by the Player ('Get Out of Jail Free')
+	};
 
 	//Card class construtor
-	Card(string description, CardAction action = NULL)
-	: description_(description), action_(action) { }
+	constexpr Card(const char* description, Effect effect = NO_EFFECT, int argument = 0)
+	: description_(description), effect_(effect), argument_(argument) { }
 
 	//Accessors methods
-	string description() { return this->description_; }
-
-	void performAction(Simulator& simulator, Player& player) {
-		if(this->action_ != NULL) {
-			this->action_(simulator, player);
-		}
-	}
+	constexpr const char* description() const { return this->description_; }
+	constexpr Effect effect() const { return this->effect_; }
+	constexpr int argument() const { return this->argument_; }
 
 private:
 
-	string description_;
-	CardAction action_;
+	const char* description_;
+	Effect effect_;
+	int argument_;
 
 };
 
 #endif
-
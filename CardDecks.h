@@ -0,0 +1,111 @@
+/**
+ * @file CardDecks.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Lays out the classic Chance and Community Chest decks as constexpr tables of
+ * Cards, in the order that a new deck is stacked. These are the decks of the
+ * classic board (see BoardDefinition::classic()); other boards bring their own. A
+ * card is identified by its position in its deck; the Simulator and the
+ * BatchSimulator both keep their decks as queues of these ids and follow a drawn
+ * card by switching on its effect.
+ *
+ * Unless a run asks for UNSHUFFLED decks, each game shuffles its decks before the
+ * first draw (see 'Shuffle.h'). A drawn card returns to the back of its deck, so
+ * a deck is otherwise drawn in the same order, lap after lap; the
+ * SHUFFLE_WHEN_EXHAUSTED policy also shuffles a deck again once every card that it
+ * held at its last shuffle has been drawn.
+ */
+
+#ifndef CARD_DECKS_H
+#define CARD_DECKS_H
+
+//Protected includes
+#include "Card.h"
+
+namespace CardDecks {
+
+	//Decks, in the order that the Simulator stacks them
+	enum Deck { CHANCE_DECK, COMMUNITY_CHEST_DECK, DECK_COUNT };
+
+	//Room for every card of the largest deck; a deck's cursor holds its size in 5 bits (see 'GameState.h')
+	constexpr int MAXIMUM_DECK_SIZE = 31;
+
+	//When a game's decks are shuffled
+	enum Shuffle { UNSHUFFLED, SHUFFLE_AT_START, SHUFFLE_WHEN_EXHAUSTED };
+
+	constexpr Card CHANCE[] = {
+		Card("Advance to Go", Card::MOVE_TO, 0),
+		Card("Advance to Illinois Ave.", Card::MOVE_TO, 24),
+		Card("Advance to St. Charles Place", Card::MOVE_TO, 11),
+		Card("Advance token to nearest Utility", Card::MOVE_TO_NEAREST_UTILITY),
+		Card("Advance to nearest Railroad", Card::MOVE_TO_NEAREST_RAILROAD),
+		Card("Bank pays you divident of $50"),
+		Card("Get Out of Jail Free", Card::KEEP_CARD),
+		Card("Go back 3 spaces", Card::MOVE_BY, -3),
+		Card("Go to Jail", Card::GO_TO_JAIL),
+		Card("Make general repairs on all your property"),
+		Card("Pay poor tax of $15"),
+		Card("Take a ride on the Reading Railroad", Card::MOVE_TO, 5),
+		Card("Advance token to Boardwalk", Card::MOVE_TO, 39),
+		Card("You have been elected Charirman of the Board"),
+		Card("Your building and loan matures"),
+		Card("You have won a crossword competition")
+	};
+
+	constexpr Card COMMUNITY_CHEST[] = {
+		Card("Advance to Go", Card::MOVE_TO, 0),
+		Card("Bank error in your favor"),
+		Card("Doctor's fees"),
+		Card("From sale of stock you get $50"),
+		Card("Get Out of Jail Free", Card::KEEP_CARD),
+		Card("Go to Jail", Card::GO_TO_JAIL),
+		Card("Grand Opera opening"),
+		Card("Xmas fund matures"),
+		Card("Income tax refund"),
+		Card("It is your birthday"),
+		Card("Life insurance matures"),
+		Card("Pay hospital fees of $100"),
+		Card("Pay school fees of $150"),
+		Card("Receive for Services $25"),
+		Card("You are assessed for street repairs"),
+		Card("You have won second prize in a beauty contest"),
+		Card("You inherit $100")
+	};
+
+	//Each deck's cards and number of cards, indexed by Deck
+	constexpr const Card* CARDS[DECK_COUNT] = { CHANCE, COMMUNITY_CHEST };
+	constexpr int SIZE[DECK_COUNT] = {
+		sizeof(CHANCE) / sizeof(Card),
+		sizeof(COMMUNITY_CHEST) / sizeof(Card)
+	};
+
+	/**
+	 * Returns the id of the first card in a deck with the given effect, or -1
+	 * if the deck has no such card.
+	 *
+	 * @param 	deck 	A Deck
+	 * @param 	effect 	The effect to look for
+	 */
+	constexpr int find(Deck deck, Card::Effect effect) {
+		for(int id = 0; id < SIZE[deck]; id++) {
+			if(CARDS[deck][id].effect() == effect) {
+				return id;
+			}
+		}
+		return -1;
+	}
+
+	//The id of each deck's 'Get Out of Jail Free' card, indexed by Deck
+	constexpr int KEPT_CARD[DECK_COUNT] = {
+		find(CHANCE_DECK, Card::KEEP_CARD),
+		find(COMMUNITY_CHEST_DECK, Card::KEEP_CARD)
+	};
+
+	static_assert(SIZE[CHANCE_DECK] <= MAXIMUM_DECK_SIZE &&
+				  SIZE[COMMUNITY_CHEST_DECK] <= MAXIMUM_DECK_SIZE,
+				  "A deck holds more cards than MAXIMUM_DECK_SIZE");
+
+};
+
+#endif
@@ -0,0 +1,138 @@
+/**
+ * @file Checkpoint.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Describes and implements the CheckpointWriter and CheckpointReader classes,
+ * which store a sequence of integers in a checkpoint file. The Simulator decides
+ * what the sequence holds (see Simulator::saveCheckpoint()); these classes only
+ * frame it. A checkpoint begins with the magic bytes "MSCK" and a format version,
+ * and every integer is written as a zigzag-encoded LEB128 varint, like the trace
+ * format (see 'Trace.h').
+ *
+ * A checkpoint is written to a temporary file that is renamed over the previous
+ * checkpoint once it is complete, so a run that is killed while checkpointing
+ * still leaves the previous checkpoint intact.
+ */
+
+#ifndef CHECKPOINT_H
+#define CHECKPOINT_H
+
+//Protected includes
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+using namespace std;
+
+namespace Checkpoint {
+
+	const char MAGIC[4] = { 'M', 'S', 'C', 'K' };
+	const int VERSION = 4;
+
+};
+
+class CheckpointWriter {
+
+public:
+
+	/**
+	 * CheckpointWriter class constructor. Creates the temporary file and writes
+	 * the checkpoint's header. Throws a runtime_error if the file can't be opened.
+	 *
+	 * @param 	path 	The path of the checkpoint
+	 */
+	CheckpointWriter(const string& path) : path_(path), temporary_(path + ".tmp") {
+		this->output_.open(this->temporary_.c_str(), ofstream::out | ofstream::trunc | ofstream::binary);
+		if(!this->output_.is_open()) {
+			throw runtime_error("Exception occured when opening a file for writing.\n\n");
+		}
+		this->output_.write(Checkpoint::MAGIC, 4);
+		this->put(Checkpoint::VERSION);
+	}
+
+	/* Writes an integer */
+	void put(long long value) {
+		unsigned long long bits = ((unsigned long long)value << 1) ^ (unsigned long long)(value >> 63);
+		while(bits >= 0x80) {
+			this->output_.put((char)(bits | 0x80));
+			bits >>= 7;
+		}
+		this->output_.put((char)bits);
+	}
+
+	/* Completes the checkpoint, replacing any previous one. Throws a runtime_error on failure. */
+	void commit() {
+		this->output_.close();
+		if(this->output_.fail() || rename(this->temporary_.c_str(), this->path_.c_str()) != 0) {
+			throw runtime_error("Exception occured when writing a checkpoint.\n\n");
+		}
+	}
+
+private:
+
+	string path_;
+	string temporary_;
+	ofstream output_;
+
+};
+
+class CheckpointReader {
+
+public:
+
+	/**
+	 * CheckpointReader class constructor. Opens a checkpoint and checks its
+	 * header. Throws a runtime_error if the file can't be opened, or isn't a
+	 * checkpoint.
+	 *
+	 * @param 	path 	The path of the checkpoint
+	 */
+	CheckpointReader(const string& path) {
+		this->input_.open(path.c_str(), ifstream::in | ifstream::binary);
+		if(!this->input_.is_open()) {
+			throw runtime_error("Exception occured when opening a file for reading.\n\n");
+		}
+		for(int i = 0; i < 4; i++) {
+			if(this->input_.get() != Checkpoint::MAGIC[i]) {
+				throw runtime_error("The file is not a checkpoint!");
+			}
+		}
+		if(this->get() != Checkpoint::VERSION) {
+			throw runtime_error("The checkpoint was written in an unsupported version of the format!");
+		}
+	}
+
+	/* Reads an integer. Throws a runtime_error if the checkpoint ends early. */
+	long long get() {
+		unsigned long long bits = 0;
+		for(int shift = 0; shift < 64; shift += 7) {
+			int byte = this->input_.get();
+			if(byte == EOF) {
+				throw runtime_error("The checkpoint ends unexpectedly!");
+			}
+			bits |= (unsigned long long)(byte & 0x7f) << shift;
+			if(!(byte & 0x80)) {
+				return (long long)(bits >> 1) ^ -(long long)(bits & 1);
+			}
+		}
+		throw runtime_error("The checkpoint holds a malformed integer!");
+	}
+
+	/* Reads an integer, and throws a runtime_error if it falls outside [lower, upper] */
+	long long get(long long lower, long long upper) {
+		long long value = this->get();
+		if(value < lower || value > upper) {
+			throw runtime_error("The checkpoint holds an out-of-range value!");
+		}
+		return value;
+	}
+
+private:
+
+	ifstream input_;
+
+};
+
+#endif
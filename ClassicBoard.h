@@ -0,0 +1,171 @@
+/**
+ * @file ClassicBoard.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Lays out the classic, pre-2008 Monopoly board as constexpr tables: each tile's
+ * name and kind, the Jail's index, and the nearest Railroad and Utility ahead of
+ * each tile. Together with the decks of 'CardDecks.h', these are everything that
+ * BoardDefinition::classic() serves, so the classic board is never built or
+ * checked at run time; the checks that BoardDefinition::compile() makes of a
+ * definition file are made of these tables by the compiler instead.
+ */
+
+#ifndef CLASSIC_BOARD_H
+#define CLASSIC_BOARD_H
+
+//Protected includes
+#include "Property.h"
+#include "Card.h"
+#include "CardDecks.h"
+#include "BoardTables.h"
+
+namespace ClassicBoard {
+
+	/* A tile of the classic board */
+	struct Tile {
+		const char* name;
+		Property::Kind kind;
+	};
+
+	constexpr Tile TILES[] = {
+		{ "Go", Property::PLAIN },
+		{ "Mediterranean Avenue", Property::PLAIN },
+		{ "Community Chest", Property::COMMUNITY_CHEST },
+		{ "Baltic Avenue", Property::PLAIN },
+		{ "Income Tax", Property::PLAIN },
+		{ "Reading Railroad", Property::RAILROAD },
+		{ "Oriental Avenue", Property::PLAIN },
+		{ "Chance", Property::CHANCE },
+		{ "Vermont Avenue", Property::PLAIN },
+		{ "Connecticut Avenue", Property::PLAIN },
+		{ "In Jail/Just Visiting", Property::JAIL },
+		{ "St. Charles Place", Property::PLAIN },
+		{ "Electric Company", Property::UTILITY },
+		{ "States Avenue", Property::PLAIN },
+		{ "Virginia Avenue", Property::PLAIN },
+		{ "Pennsylvania Railroad", Property::RAILROAD },
+		{ "St. James Place", Property::PLAIN },
+		{ "Community Chest", Property::COMMUNITY_CHEST },
+		{ "Tennessee Avenue", Property::PLAIN },
+		{ "New York Avenue", Property::PLAIN },
+		{ "Free Parking", Property::PLAIN },
+		{ "Kentucky Avenue", Property::PLAIN },
+		{ "Chance", Property::CHANCE },
+		{ "Indiana Avenue", Property::PLAIN },
+		{ "Illinois Avenue", Property::PLAIN },
+		{ "B. & O. Railroad", Property::RAILROAD },
+		{ "Alantic Avenue", Property::PLAIN },
+		{ "Ventnor Avenue", Property::PLAIN },
+		{ "Water Works", Property::UTILITY },
+		{ "Marvin Gardens", Property::PLAIN },
+		{ "Go To Jail", Property::GO_TO_JAIL },
+		{ "Pacific Avenue", Property::PLAIN },
+		{ "North Carolina AVenue", Property::PLAIN },
+		{ "Community Chest", Property::COMMUNITY_CHEST },
+		{ "Pennsylvania Avenue", Property::PLAIN },
+		{ "Short Line", Property::RAILROAD },
+		{ "Chance", Property::CHANCE },
+		{ "Park Place", Property::PLAIN },
+		{ "Luxury Tax", Property::PLAIN },
+		{ "Boardwalk", Property::PLAIN }
+	};
+
+	constexpr int SIZE = sizeof(TILES) / sizeof(Tile);
+
+	/* A table with one entry per tile, indexed by Board location */
+	template<class T> struct Table {
+		T at[SIZE];
+	};
+
+	/* Returns the tiles' names */
+	constexpr Table<const char*> names() {
+		Table<const char*> table = {};
+		for(int i = 0; i < SIZE; i++) {
+			table.at[i] = TILES[i].name;
+		}
+		return table;
+	}
+
+	/* Returns the tiles' kinds, a byte each */
+	constexpr Table<unsigned char> kinds() {
+		Table<unsigned char> table = {};
+		for(int i = 0; i < SIZE; i++) {
+			table.at[i] = (unsigned char)TILES[i].kind;
+		}
+		return table;
+	}
+
+	/**
+	 * Returns the index of the first tile of the given kind, or -1 if the board
+	 * has no such tile.
+	 *
+	 * @param 	kind 	The kind of tile to look for
+	 */
+	constexpr int find(Property::Kind kind) {
+		for(int i = 0; i < SIZE; i++) {
+			if(TILES[i].kind == kind) {
+				return i;
+			}
+		}
+		return -1;
+	}
+
+	/**
+	 * Returns, for each tile, the index of the first tile of the given kind that
+	 * lies ahead of it (see BoardTables::nearest()).
+	 *
+	 * @param 	kind 	The kind of tile to jump to
+	 */
+	constexpr Table<signed char> nearest(Property::Kind kind) {
+		Table<unsigned char> tile_kinds = kinds();
+		Table<signed char> table = {};
+		for(int i = 0; i < SIZE; i++) {
+			table.at[i] = (signed char)BoardTables::nearest(tile_kinds.at, SIZE, i, kind);
+		}
+		return table;
+	}
+
+	/* Returns whether every card of the classic decks leads somewhere on the board */
+	constexpr bool cardsFit() {
+		for(int d = 0; d < CardDecks::DECK_COUNT; d++) {
+			for(int id = 0; id < CardDecks::SIZE[d]; id++) {
+				const Card& card = CardDecks::CARDS[d][id];
+				if(card.effect() == Card::MOVE_TO && (card.argument() < 0 || card.argument() >= SIZE)) {
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+
+	/* Returns whether no chain of draws can empty a classic deck (see BoardTables::chainedDraws()) */
+	constexpr bool decksLast() {
+		Table<unsigned char> tile_kinds = kinds();
+		for(int d = 0; d < CardDecks::DECK_COUNT; d++) {
+			int kept = (CardDecks::KEPT_CARD[d] == -1) ? 0 : 1;
+			if(BoardTables::chainedDraws(tile_kinds.at, SIZE, CardDecks::CARDS, CardDecks::SIZE, d) > CardDecks::SIZE[d] - kept) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	//Tables derived from the tiles
+	constexpr Table<const char*> NAMES = names();
+	constexpr Table<unsigned char> KINDS = kinds();
+	constexpr int JAIL_LOCATION = find(Property::JAIL);
+	constexpr Table<signed char> NEAREST_RAILROAD = nearest(Property::RAILROAD);
+	constexpr Table<signed char> NEAREST_UTILITY = nearest(Property::UTILITY);
+
+	static_assert(JAIL_LOCATION != -1, "The classic board has no Jail");
+	static_assert(NEAREST_RAILROAD.at[7] == 15 && NEAREST_RAILROAD.at[36] == 5,
+				  "The nearest Railroad table is wrong");
+	static_assert(NEAREST_UTILITY.at[22] == 28 && NEAREST_UTILITY.at[36] == 12,
+				  "The nearest Utility table is wrong");
+	static_assert(cardsFit(), "A classic card moves to a tile that doesn't exist");
+	static_assert(decksLast(), "A chain of classic cards can empty a deck");
+
+};
+
+#endif
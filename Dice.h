@@ -0,0 +1,115 @@
+/**
+ * @file Dice.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Describes and implements the DiceStream class, a buffered source of die rolls
+ * layered on top of a RandomStream. Rather than spending a random word on every
+ * die, the DiceStream generates a block of 64-bit words at a time and extracts up
+ * to 23 rolls from each one: a word below 23 * 6^23 is a uniformly distributed
+ * 23-digit number in base 6 (words at or above that limit, about 1.5% of them,
+ * are discarded so that no face is favored). Each digit is one roll.
+ */
+
+#ifndef DICE_H
+#define DICE_H
+
+//Protected includes
+#include "Random.h"
+
+class DiceStream {
+
+public:
+
+	//Number of 64-bit words generated per refill
+	static const int BLOCK_WORDS = 8;
+	//Number of base-6 digits extracted from each word
+	static const int ROLLS_PER_WORD = 23;
+	static const int BUFFER_SIZE = BLOCK_WORDS * ROLLS_PER_WORD;
+
+	/**
+	 * DiceStream class constructor. Rolls are drawn from the addressed stream.
+	 *
+	 * @param 	seed 	The simulation's seed
+	 * @param 	game 	The index of the game that owns the stream
+	 * @param 	stream 	The index of the stream within the game (e.g. a Player id)
+	 */
+	DiceStream(unsigned long long seed = 0, unsigned int game = 0, unsigned int stream = 0)
+	: random_(seed, game, stream), block_(0), size_(0), next_(0) { }
+
+	//Accessor methods
+
+	/* Returns the number of blocks generated so far */
+	unsigned long long blocksUsed() const { return this->block_; }
+
+	/* Returns the number of rolls taken from the most recent block */
+	int rollsUsed() const { return this->next_; }
+
+	//Mutator methods
+
+	/**
+	 * Moves the stream to a position reported by blocksUsed() and rollsUsed(),
+	 * so that it continues with exactly the rolls it would have made from there.
+	 *
+	 * @param 	blocks 	The number of blocks generated
+	 * @param 	rolls 	The number of rolls taken from the last block
+	 */
+	void seek(unsigned long long blocks, int rolls) {
+		this->block_ = 0;
+		this->size_ = 0;
+		this->next_ = 0;
+		if(blocks > 0) {
+			//Regenerate the last block, and skip the rolls already taken from it
+			this->block_ = blocks - 1;
+			this->refill();
+			this->next_ = (rolls < this->size_) ? rolls : this->size_;
+		}
+	}
+
+	/* Returns the next die roll, in the range [1, 6] */
+	int roll() {
+		while(this->next_ == this->size_) {
+			this->refill();
+		}
+		return this->buffer_[this->next_++];
+	}
+
+private:
+
+	RandomStream random_;
+	unsigned long long block_;
+
+	unsigned char buffer_[BUFFER_SIZE];
+	int size_;
+	int next_;
+
+	/* Generates the next block of words and extracts their rolls */
+	void refill() {
+		//6^23, and the largest multiple of it that fits in a 64-bit word
+		const unsigned long long RADIX = 789730223053602816ULL;
+		const unsigned long long LIMIT = 23 * RADIX;
+		unsigned int words[2 * BLOCK_WORDS];
+		for(int b = 0; b < BLOCK_WORDS / 2; b++) {
+			this->random_.generate(this->block_ * (BLOCK_WORDS / 2) + b, &words[4 * b]);
+		}
+		this->block_++;
+		int size = 0;
+		for(int w = 0; w < BLOCK_WORDS; w++) {
+			unsigned long long word = words[2 * w] | ((unsigned long long)words[2 * w + 1] << 32);
+			if(word >= LIMIT) {
+				continue;
+			}
+			word %= RADIX;
+			for(int d = 0; d < ROLLS_PER_WORD; d++) {
+				this->buffer_[size + d] = (unsigned char)(word % 6) + 1;
+				word /= 6;
+			}
+			size += ROLLS_PER_WORD;
+		}
+		this->size_ = size;
+		this->next_ = 0;
+	}
+
+};
+
+#endif
@@ -0,0 +1,160 @@
+/**
+ * @file GameState.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Describes and implements the PlayerState and DeckCursor classes, the packed
+ * state of a game in progress. A PlayerState holds everything that the turn logic
+ * knows about a Player in 16 bits:
+ *
+ * 		bits 0-5 	location 			(a Board index, below LOCATION_COUNT)
+ * 		bit 6 		detained
+ * 		bits 7-8 	turns served in Jail
+ * 		bits 9-10 	'Get Out of Jail Free' cards held, one bit per deck
+ *
+ * and a DeckCursor holds a deck's position in its ring of card ids in another 16:
+ *
+ * 		bits 0-4 	head 				(the slot of the card on top)
+ * 		bits 5-9 	size 				(the cards in the deck)
+ * 		bits 10-14 	undrawn 			(draws left before the deck is exhausted)
+ *
+ * The Simulator's Players and the BatchSimulator's lanes both keep their state in
+ * these classes and only ever use their accessors, so the layout can change
+ * without touching the turn logic. Packed this tightly, a six-Player game's Players
+ * and deck cursors take 16 bytes, and the state of every game in flight stays in
+ * cache.
+ */
+
+#ifndef GAME_STATE_H
+#define GAME_STATE_H
+
+//Protected includes
+#include "CardDecks.h"
+
+class PlayerState {
+
+public:
+
+	//Most turns that a Player may serve in Jail before they must leave
+	static const int MAXIMUM_JAIL_SENTENCE = 2;
+	//Number of Board locations that the location field can hold
+	static const int LOCATION_COUNT = 64;
+
+	//PlayerState class constructor; a new Player is free, on 'Go', with no cards
+	PlayerState() : bits_(0) { }
+
+	//Accessor methods
+	int location() const { return this->bits_ & LOCATION_MASK; }
+	bool isDetained() const { return (this->bits_ >> DETAINED_SHIFT) & 1; }
+	int turnsInJail() const { return (this->bits_ >> TURNS_SHIFT) & TURNS_MASK; }
+	bool hasGetOutOfJailCard(CardDecks::Deck deck) const { return (this->bits_ >> (CARD_SHIFT + deck)) & 1; }
+	bool hasGetOutOfJailCard() const { return (this->bits_ >> CARD_SHIFT) != 0; }
+
+	//Mutator methods
+
+	/* Places the Player; an index beyond the field is wrapped rather than spilling into the others */
+	void setLocation(int n) {
+		this->bits_ = (unsigned short)((this->bits_ & ~LOCATION_MASK) | (n & LOCATION_MASK));
+	}
+
+	/* Locks up or frees the Player, resetting their 'time served' */
+	void setDetention(bool detained) {
+		this->setJail(detained, 0);
+	}
+
+	/* Counts another turn served, if the Player is detained (up to the field's limit) */
+	void incrementTurnsInJail() {
+		if(this->isDetained() && this->turnsInJail() < TURNS_MASK) {
+			this->bits_ = (unsigned short)(this->bits_ + (1 << TURNS_SHIFT));
+		}
+	}
+
+	/**
+	 * Sets whether the Player is detained and the turns they have served at once,
+	 * for the batch loops' branch-free updates.
+	 *
+	 * @param 	detained 	1 if the Player is detained, otherwise 0
+	 * @param 	turns 		The turns served, at most MAXIMUM_JAIL_SENTENCE + 1
+	 */
+	void setJail(int detained, int turns) {
+		this->bits_ = (unsigned short)((this->bits_ & ~JAIL_MASK) | (detained << DETAINED_SHIFT) | (turns << TURNS_SHIFT));
+	}
+
+	void setGetOutOfJailCard(CardDecks::Deck deck, bool held) {
+		this->bits_ = (unsigned short)((this->bits_ & ~(1 << (CARD_SHIFT + deck))) | ((int)held << (CARD_SHIFT + deck)));
+	}
+
+private:
+
+	static const int LOCATION_MASK = 0x3f;
+	static const int DETAINED_SHIFT = 6;
+	static const int TURNS_SHIFT = 7;
+	static const int TURNS_MASK = 3;
+	static const int JAIL_MASK = (1 << DETAINED_SHIFT) | (TURNS_MASK << TURNS_SHIFT);
+	static const int CARD_SHIFT = 9;
+
+	unsigned short bits_;
+
+};
+
+class DeckCursor {
+
+public:
+
+	//DeckCursor class constructor; an empty deck
+	DeckCursor() : bits_(0) { }
+
+	//Accessor methods
+	int head() const { return this->bits_ & FIELD_MASK; }
+	int size() const { return (this->bits_ >> SIZE_SHIFT) & FIELD_MASK; }
+	int undrawn() const { return (this->bits_ >> UNDRAWN_SHIFT) & FIELD_MASK; }
+
+	//Mutator methods
+
+	/**
+	 * Starts the deck afresh: its cards lie in the first 'size' slots, and none
+	 * of them has been drawn.
+	 *
+	 * @param 	size 	The number of cards in the deck
+	 */
+	void reset(int size) {
+		this->bits_ = (unsigned short)((size << SIZE_SHIFT) | (size << UNDRAWN_SHIFT));
+	}
+
+	/**
+	 * Takes the card on top of the deck, moving the head on around the ring.
+	 *
+	 * @param 	capacity 	The number of slots in the ring (the deck's full size)
+	 */
+	void pop(int capacity) {
+		int head = this->head() + 1;
+		head = (head == capacity) ? 0 : head;
+		this->bits_ = (unsigned short)((this->bits_ & ~FIELD_MASK) - (1 << SIZE_SHIFT) + head);
+	}
+
+	/* Counts a card back in, at the bottom of the deck */
+	void push() {
+		this->bits_ = (unsigned short)(this->bits_ + (1 << SIZE_SHIFT));
+	}
+
+	/* Counts a draw against the cards left before the deck is exhausted */
+	void countDraw() {
+		this->bits_ = (unsigned short)(this->bits_ - (1 << UNDRAWN_SHIFT));
+	}
+
+private:
+
+	static const int FIELD_MASK = 0x1f;
+	static const int SIZE_SHIFT = 5;
+	static const int UNDRAWN_SHIFT = 10;
+
+	unsigned short bits_;
+
+};
+
+//The fields must be wide enough for any deck (see 'Board.h' for locations)
+static_assert(PlayerState::MAXIMUM_JAIL_SENTENCE < 3, "A sentence doesn't fit in 2 bits");
+static_assert(CardDecks::DECK_COUNT == 2, "The held cards don't fit in 2 bits");
+static_assert(CardDecks::MAXIMUM_DECK_SIZE <= 31, "A deck cursor's fields don't fit in 5 bits");
+
+#endif
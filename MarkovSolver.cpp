@@ -0,0 +1,504 @@
+/**
+ * @file MarkovSolver.cpp
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Contains implementation of the public interface and private methods of
+ * the MarkovSolver class. For details about this class, see 'MarkovSolver.h'.
+ */
+
+//Protected includes
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <ostream>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+//Class header include
+#include "MarkovSolver.h"
+
+//Class dependencies
+#include "SimulatorConfig.h"
+#include "Board.h"
+#include "BoardDefinition.h"
+#include "Property.h"
+#include "Player.h"
+#include "Card.h"
+#include "CardDecks.h"
+#include "BoardTables.h"
+#include "lib/SparseMatrix.h"
+#include "lib/Solvers.h"
+#include "lib/ThreadPool.h"
+
+using namespace std;
+
+/*** Public interface implementation ***/
+
+/**
+ * MarkovSolver class constructor. Accepts an existing SimulatorConfig object
+ * (including the number of threads), and builds the chain's transitions from the
+ * configured board and decks. Throws an invalid_argument exception for a game
+ * that the chain can't follow exactly (see above), and a length_error for a board
+ * whose chain would be too large to solve.
+ *
+ * @param 	config 	An existing SimulatorConfig object
+ */
+MarkovSolver::MarkovSolver(SimulatorConfig config) : config_(config), definition_(config.board()), method_(BICGSTAB) {
+	if(this->config_.playerCount() != 1 || this->config_.shufflePolicy() != CardDecks::UNSHUFFLED) {
+		throw invalid_argument("The Markov solver is only exact for a lone Player drawing from unshuffled decks!");
+	}
+	this->thread_count_ = this->config_.threadCount();
+	if(this->thread_count_ == 0) {
+		//Use every core (hardware_concurrency() may not know, and return 0)
+		this->thread_count_ = thread::hardware_concurrency();
+		if(this->thread_count_ == 0) {
+			this->thread_count_ = 1;
+		}
+	}
+	this->result_.converged = false;
+	this->result_.iterations = 0;
+	this->result_.residual = 0;
+	//Number the Chance and Community Chest tiles
+	for(int i = 0; i < this->definition_->size(); i++) {
+		this->probabilities_[i] = 0;
+		this->draw_index_[i] = -1;
+		if(this->deckAt(i) != -1) {
+			this->draw_index_[i] = (int)this->draw_tiles_.size();
+			this->draw_tiles_.push_back(i);
+		}
+	}
+	if(this->draw_tiles_.empty()) {
+		throw invalid_argument("The Markov solver steps from draw to draw, but the board has no Chance or Community Chest tiles!");
+	}
+	this->checkDecks();
+	//Count the orders that the decks can be in
+	long long orders = 1;
+	for(int d = 0; d < CardDecks::DECK_COUNT; d++) {
+		bool keeps = (this->definition_->keptCard((CardDecks::Deck)d) != -1);
+		this->others_[d] = this->definition_->deckSize((CardDecks::Deck)d) - (keeps ? 1 : 0);
+		this->cursor_places_[d] = max(this->others_[d], 1);
+		this->kept_places_[d] = keeps ? this->others_[d] + 2 : 1;
+		orders *= this->cursor_places_[d] * this->kept_places_[d];
+	}
+	if(orders * (long long)this->draw_tiles_.size() * ROLL_STATES > MAXIMUM_STATES) {
+		throw length_error("The board's decks can be in too many orders for the Markov solver!");
+	}
+	this->deck_orders_ = (int)orders;
+	this->buildWalks();
+	this->buildChain();
+}
+
+//MarkovSolver class destructor
+MarkovSolver::~MarkovSolver() { }
+
+/* Solves the chain and records the resulting statistics */
+void MarkovSolver::runSimulation() {
+	this->solve();
+	ofstream output_handle;
+	output_handle.open(this->config_.outputPath().c_str(), ofstream::out | ofstream::trunc);
+	if(!output_handle.is_open()) {
+		throw runtime_error("Exception occured when opening a file for writing.\n\n");
+	}
+	output_handle << "Num Players: " << this->config_.playerCount() << " ";
+	output_handle << "Turns: " << this->config_.turnCount() << "\n";
+	output_handle << "States: " << this->stateCount() << "\n";
+	this->printPropertyStatistics(output_handle);
+	output_handle << "\n";
+}
+
+/**
+ * Finds the chain's stationary distribution, and weights each state's expected
+ * landings by it. BiCGSTAB falls back on power iteration if it fails to converge.
+ * The products of both run on one pool of threads, started once for the solve.
+ *
+ * @param 	method 	The method to try first
+ */
+void MarkovSolver::solve(Method method) {
+	int n = this->stateCount();
+	vector<double> distribution(n, 1.0 / n);
+	ThreadPool pool(this->thread_count_);
+	this->method_ = method;
+	if(method == BICGSTAB) {
+		//(I - P')x, with the first equation replaced by sum(x)
+		auto balance = [this, n, &pool](const double* x, double* y) {
+			this->transposed_.multiply(x, y, pool);
+			double total = 0;
+			for(int r = 0; r < n; r++) {
+				y[r] = x[r] - y[r];
+				total += x[r];
+			}
+			y[0] = total;
+		};
+		vector<double> b(n, 0.0);
+		b[0] = 1.0;
+		this->result_ = Solvers::bicgstab(balance, b, distribution, TOLERANCE, MAXIMUM_ITERATIONS);
+		if(!this->result_.converged) {
+			this->method_ = POWER_ITERATION;
+			fill(distribution.begin(), distribution.end(), 1.0 / n);
+		}
+	}
+	if(this->method_ == POWER_ITERATION) {
+		//A lazy step (staying put half of the time) has the same stationary
+		//distribution, but can't cycle, should the draws come round periodically
+		auto step = [this, n, &pool](const double* x, double* y) {
+			this->transposed_.multiply(x, y, pool);
+			for(int r = 0; r < n; r++) {
+				y[r] = 0.5 * (x[r] + y[r]);
+			}
+		};
+		this->result_ = Solvers::powerIteration(step, distribution, TOLERANCE, MAXIMUM_ITERATIONS);
+	}
+	//Expected landings per draw in the long run, and each Property's share of them
+	int size = this->definition_->size();
+	int width = this->walkWidth();
+	for(int i = 0; i < size; i++) {
+		this->probabilities_[i] = 0;
+	}
+	for(int r = 0; r < n; r++) {
+		int state = this->states_[r];
+		Decks decks = this->decode(state % this->deck_orders_);
+		Position rest = this->draw(state / this->deck_orders_, decks, this->probabilities_, distribution[r]);
+		const double* walk = &this->walks_[this->positionIndex(rest) * width + width - size];
+		for(int i = 0; i < size; i++) {
+			this->probabilities_[i] += distribution[r] * walk[i];
+		}
+	}
+	double total = 0;
+	for(int i = 0; i < size; i++) {
+		total += this->probabilities_[i];
+	}
+	for(int i = 0; i < size; i++) {
+		this->probabilities_[i] /= total;
+	}
+}
+
+/* Returns the long-run share of all landings made on the nth Property */
+double MarkovSolver::landingProbability(int n) const {
+	return this->probabilities_[Board::wrapIndex(n, 0, this->definition_->size() - 1)];
+}
+
+/* Outputs 'landed on' probabilities for all Properties on the Board */
+void MarkovSolver::printPropertyStatistics(ostream& output) const {
+	output << "\n";
+	output.setf(ios::fixed);
+	output.precision(8);
+	for(int i = 0; i < this->definition_->size(); i++) {
+		output << this->definition_->tileName(i) << " :: " << this->probabilities_[i] << "\n";
+	}
+}
+
+/*** Private method implementation ***/
+
+/**
+ * Throws an invalid_argument exception if a chain of cards can draw twice from
+ * the same deck: the deck would get its two cards back in the opposite order to
+ * the one that they were drawn in, which the cursors can't describe. A deck feeds
+ * another if one of its cards can move the Player onto the other's tiles.
+ */
+void MarkovSolver::checkDecks() const {
+	unsigned char kinds[Board::MAXIMUM_SIZE];
+	for(int i = 0; i < this->definition_->size(); i++) {
+		kinds[i] = (unsigned char)this->definition_->kind(i);
+	}
+	bool feeds[CardDecks::DECK_COUNT][CardDecks::DECK_COUNT];
+	for(int d = 0; d < CardDecks::DECK_COUNT; d++) {
+		for(int e = 0; e < CardDecks::DECK_COUNT; e++) {
+			feeds[d][e] = false;
+			for(int id = 0; id < this->definition_->deckSize((CardDecks::Deck)d); id++) {
+				const Card& card = this->definition_->card((CardDecks::Deck)d, id);
+				feeds[d][e] = feeds[d][e] || BoardTables::reaches(kinds, this->definition_->size(), card, d, BoardTables::drawTile(e));
+			}
+		}
+	}
+	//Decks that feed each other, in turn, feed themselves
+	for(int via = 0; via < CardDecks::DECK_COUNT; via++) {
+		for(int d = 0; d < CardDecks::DECK_COUNT; d++) {
+			for(int e = 0; e < CardDecks::DECK_COUNT; e++) {
+				feeds[d][e] = feeds[d][e] || (feeds[d][via] && feeds[via][e]);
+			}
+		}
+	}
+	for(int d = 0; d < CardDecks::DECK_COUNT; d++) {
+		if(feeds[d][d]) {
+			throw invalid_argument("A chain of cards can draw twice from one deck, so the Markov solver can't follow its order!");
+		}
+	}
+}
+
+/**
+ * Works out the walk from every Position to the next draw. The expected outcomes
+ * of each Position are those of its roll plus those of the Positions that the
+ * roll leads to, so they are iterated (in place) until they no longer change.
+ */
+void MarkovSolver::buildWalks() {
+	int width = this->walkWidth();
+	int positions = this->definition_->size() * JAIL_STATES * ROLL_STATES * HAND_STATES;
+	//Each Position's roll: the Positions that it leads to, and what it adds directly
+	vector<vector<pair<int, double> > > steps(positions);
+	vector<double> direct(positions * width, 0.0);
+	for(int location = 0; location < this->definition_->size(); location++) {
+		for(int jail = 0; jail < JAIL_STATES; jail++) {
+			for(int rolls = 0; rolls < ROLL_STATES; rolls++) {
+				for(int hand = 0; hand < HAND_STATES; hand++) {
+					Position position = { location, jail, rolls, hand };
+					int p = this->positionIndex(position);
+					this->roll(position, steps[p], &direct[p * width]);
+				}
+			}
+		}
+	}
+	this->walks_ = direct;
+	for(int iteration = 0; iteration < MAXIMUM_ITERATIONS; iteration++) {
+		bool changed = false;
+		for(int p = 0; p < positions; p++) {
+			double* walk = &this->walks_[p * width];
+			for(int w = 0; w < width; w++) {
+				double value = direct[p * width + w];
+				for(unsigned int s = 0; s < steps[p].size(); s++) {
+					value += steps[p][s].second * this->walks_[steps[p][s].first * width + w];
+				}
+				changed = changed || fabs(value - walk[w]) > WALK_TOLERANCE * max(1.0, fabs(value));
+				walk[w] = value;
+			}
+		}
+		if(!changed) {
+			return;
+		}
+	}
+	throw runtime_error("The walks between draws failed to converge!");
+}
+
+/**
+ * Follows every draw that a Player starting on 'Go' can reach, from one draw to
+ * the next, recording the transitions. Rows are numbered in the order that their
+ * states are reached.
+ */
+void MarkovSolver::buildChain() {
+	vector<SparseMatrix::Entry> entries;
+	double landings[Board::MAXIMUM_SIZE];
+	int width = this->walkWidth();
+	this->rows_.assign((int)this->draw_tiles_.size() * ROLL_STATES * this->deck_orders_, -1);
+	//The Player starts on 'Go', with every deck in its initial order
+	Decks initial;
+	for(int d = 0; d < CardDecks::DECK_COUNT; d++) {
+		initial.cursor[d] = 0;
+		initial.kept[d] = max(this->definition_->keptCard((CardDecks::Deck)d), 0);
+	}
+	Position start = { 0, 0, 0, 0 };
+	const double* walk = &this->walks_[this->positionIndex(start) * width];
+	for(int draw = 0; draw < (int)this->draw_tiles_.size() * ROLL_STATES; draw++) {
+		if(walk[draw * HAND_STATES] > 0) {
+			this->rowOf(draw * this->deck_orders_ + this->encode(initial));
+		}
+	}
+	for(unsigned int row = 0; row < this->states_.size(); row++) {
+		//Make the row's draw, and follow the walk from where the Player comes to rest
+		int state = this->states_[row];
+		Decks decks = this->decode(state % this->deck_orders_);
+		Position rest = this->draw(state / this->deck_orders_, decks, landings, 0);
+		walk = &this->walks_[this->positionIndex(rest) * width];
+		for(int column = 0; column < width - this->definition_->size(); column++) {
+			if(walk[column] > 0) {
+				//Kept cards that were used on the way go to the back of their decks
+				Decks next = decks;
+				int hand = column % HAND_STATES;
+				for(int d = 0; d < CardDecks::DECK_COUNT; d++) {
+					if((rest.hand & (1 << d)) && !(hand & (1 << d))) {
+						next.kept[d] = this->others_[d];
+					}
+				}
+				SparseMatrix::Entry entry = { this->rowOf(column / HAND_STATES * this->deck_orders_ + this->encode(next)), (int)row, walk[column] };
+				entries.push_back(entry);
+			}
+		}
+	}
+	this->transposed_ = SparseMatrix(this->stateCount(), this->stateCount(), entries);
+}
+
+/* Returns the row of an encoded state, numbering it if it was not yet reached */
+int MarkovSolver::rowOf(int state) {
+	if(this->rows_[state] == -1) {
+		this->rows_[state] = (int)this->states_.size();
+		this->states_.push_back(state);
+	}
+	return this->rows_[state];
+}
+
+/* Returns the deck drawn from on a Board index, or -1 if it draws no card */
+int MarkovSolver::deckAt(int location) const {
+	Property::Kind kind = this->definition_->kind(location);
+	if(kind == Property::CHANCE) {
+		return CardDecks::CHANCE_DECK;
+	}
+	return (kind == Property::COMMUNITY_CHEST) ? CardDecks::COMMUNITY_CHEST_DECK : -1;
+}
+
+/* Returns the width of a walk: its draws (by tile, rolls and hand), then landings */
+int MarkovSolver::walkWidth() const {
+	return (int)this->draw_tiles_.size() * ROLL_STATES * HAND_STATES + this->definition_->size();
+}
+
+/* Returns the walk column of a draw, made on a tile with the given rolls and hand */
+int MarkovSolver::drawColumn(int location, int rolls, int hand) const {
+	return (this->draw_index_[location] * ROLL_STATES + rolls) * HAND_STATES + hand;
+}
+
+int MarkovSolver::positionIndex(const Position& position) const {
+	return ((position.hand * ROLL_STATES + position.rolls) * JAIL_STATES + position.jail) * this->definition_->size() + position.location;
+}
+
+int MarkovSolver::encode(const Decks& decks) const {
+	int order = 0;
+	for(int d = 0; d < CardDecks::DECK_COUNT; d++) {
+		order = (order * this->cursor_places_[d] + decks.cursor[d]) * this->kept_places_[d] + decks.kept[d];
+	}
+	return order;
+}
+
+MarkovSolver::Decks MarkovSolver::decode(int order) const {
+	Decks decks;
+	for(int d = CardDecks::DECK_COUNT - 1; d >= 0; d--) {
+		decks.kept[d] = order % this->kept_places_[d];
+		order /= this->kept_places_[d];
+		decks.cursor[d] = order % this->cursor_places_[d];
+		order /= this->cursor_places_[d];
+	}
+	return decks;
+}
+
+/* Returns the hand of kept cards that the decks are missing */
+int MarkovSolver::handOf(const Decks& decks) const {
+	int hand = 0;
+	for(int d = 0; d < CardDecks::DECK_COUNT; d++) {
+		if(this->definition_->keptCard((CardDecks::Deck)d) != -1 && decks.kept[d] == this->others_[d] + 1) {
+			hand |= 1 << d;
+		}
+	}
+	return hand;
+}
+
+/**
+ * Follows each of the 36 outcomes of a roll from a Position (see the PRE_ROLL,
+ * JAIL and ROLLED states of Simulator::simulateTurn()), as far as the next
+ * Position or draw.
+ *
+ * @param 	position 	Where the Player stands before the roll
+ * @param 	steps 		Receives the Positions that the roll leads to, with their
+ * 						probabilities
+ * @param 	walk 		Receives the probabilities of the draws that the roll leads
+ * 						to, and its expected landings (see walkWidth())
+ */
+void MarkovSolver::roll(Position position, vector<pair<int, double> >& steps, double* walk) {
+	//A detained Player uses a 'Get Out of Jail Free' card, if they hold one
+	if(position.jail > 0) {
+		for(int d = 0; d < CardDecks::DECK_COUNT; d++) {
+			if(position.hand & (1 << d)) {
+				position.hand &= ~(1 << d);
+				position.jail = 0;
+				break;
+			}
+		}
+	}
+	double* landings = walk + this->walkWidth() - this->definition_->size();
+	int rolls = position.rolls + 1;
+	double outcome = 1.0 / 36;
+	for(int die1 = 1; die1 <= 6; die1++) {
+		for(int die2 = 1; die2 <= 6; die2++) {
+			bool doubles = (die1 == die2);
+			int destination = Board::wrapIndex(position.location + die1 + die2, 0, this->definition_->size() - 1);
+			if(position.jail > 0 && !doubles && position.jail - 1 < Player::MAXIMUM_JAIL_SENTENCE) {
+				Position stayed = { position.location, position.jail + 1, 0, position.hand };
+				steps.push_back(make_pair(this->positionIndex(stayed), outcome));
+			} else
+			if(position.jail == 0 && doubles && rolls >= 3) {
+				Position arrested = this->arrest(position, landings, outcome);
+				steps.push_back(make_pair(this->positionIndex(arrested), outcome));
+			} else {
+				//Move (or, in Jail, be released and move)
+				landings[destination] += outcome;
+				Position moved = { destination, 0, doubles ? rolls : 0, position.hand };
+				if(this->definition_->kind(destination) == Property::GO_TO_JAIL) {
+					moved = this->arrest(moved, landings, outcome);
+					steps.push_back(make_pair(this->positionIndex(moved), outcome));
+				} else
+				if(this->draw_index_[destination] != -1) {
+					walk[this->drawColumn(destination, moved.rolls, moved.hand)] += outcome;
+				} else {
+					steps.push_back(make_pair(this->positionIndex(moved), outcome));
+				}
+			}
+		}
+	}
+}
+
+/**
+ * Makes a draw, and follows the card drawn (and any card that it leads to) to
+ * where the Player comes to rest (see the MOVED state of Simulator::simulateTurn()
+ * and Simulator::followCard()). Each deck drawn from moves on by one card, and a
+ * kept card drawn leaves its deck for the Player's hand.
+ *
+ * @param 	draw 		The draw, by its tile's index among the draw tiles and the
+ * 						rolls made (see ROLL_STATES)
+ * @param 	decks 		The order of the decks, which is updated
+ * @param 	landings 	Receives the landings made along the way
+ * @param 	weight 		The amount to add for each landing
+ */
+MarkovSolver::Position MarkovSolver::draw(int draw, Decks& decks, double* landings, double weight) const {
+	int location = this->draw_tiles_[draw / ROLL_STATES];
+	int rolls = draw % ROLL_STATES;
+	while(true) {
+		CardDecks::Deck deck = (CardDecks::Deck)this->deckAt(location);
+		int kept = this->definition_->keptCard(deck);
+		if(kept != -1 && decks.kept[deck] == 0) {
+			//The kept card is at the front, and goes to the Player's hand
+			decks.kept[deck] = this->others_[deck] + 1;
+			Position keeping = { location, 0, rolls, this->handOf(decks) };
+			return keeping;
+		}
+		//Draw the card at the cursor; it goes back behind the kept card
+		int cursor = decks.cursor[deck];
+		int id = (kept == -1 || cursor < kept) ? cursor : cursor + 1;
+		decks.cursor[deck] = (cursor + 1) % this->others_[deck];
+		if(kept != -1 && decks.kept[deck] <= this->others_[deck]) {
+			decks.kept[deck]--;
+		}
+		Position rest = { location, 0, rolls, this->handOf(decks) };
+		const Card& card = this->definition_->card(deck, id);
+		switch(card.effect()) {
+			case Card::MOVE_TO:
+				rest.location = card.argument();
+				break;
+			case Card::MOVE_BY:
+				rest.location = Board::wrapIndex(location + card.argument(), 0, this->definition_->size() - 1);
+				break;
+			case Card::MOVE_TO_NEAREST_RAILROAD:
+				rest.location = this->definition_->nearestRailroad(location);
+				break;
+			case Card::MOVE_TO_NEAREST_UTILITY:
+				rest.location = this->definition_->nearestUtility(location);
+				break;
+			case Card::GO_TO_JAIL:
+				return this->arrest(rest, landings, weight);
+			default:
+				return rest;
+		}
+		landings[rest.location] += weight;
+		if(this->definition_->kind(rest.location) == Property::GO_TO_JAIL) {
+			return this->arrest(rest, landings, weight);
+		}
+		if(this->draw_index_[rest.location] == -1) {
+			return rest;
+		}
+		location = rest.location;
+	}
+}
+
+/* Sends the Player to Jail, which ends their turn, and returns where they rest */
+MarkovSolver::Position MarkovSolver::arrest(const Position& position, double* landings, double probability) const {
+	landings[this->definition_->jailLocation()] += probability;
+	Position arrested = { this->definition_->jailLocation(), 1, 0, position.hand };
+	return arrested;
+}
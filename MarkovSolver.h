@@ -0,0 +1,175 @@
+/**
+ * @file MarkovSolver.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Describes the public interface and private methods of the MarkovSolver class.
+ * Rather than sampling games, the solver models a lone Player's game as a Markov
+ * chain and computes its exact long-run landing probabilities. The decks are the
+ * only state that a game carries beyond the Player's own, so the model is exact
+ * only for the configurations that it accepts: a single Player (another Player's
+ * draws would change which cards come up), UNSHUFFLED decks (see 'CardDecks.h'),
+ * and a board on which no chain of cards draws twice from the same deck (the two
+ * cards would go back in the opposite order, see Simulator::simulateTurn()).
+ * Anything else is refused with an invalid_argument exception.
+ *
+ * An unshuffled deck is drawn in a fixed cycle: a drawn card goes back to the back
+ * of its deck, so the deck's other cards always come up in the same order, and
+ * only its kept ('Get Out of Jail Free') card moves: it leaves the deck when it is
+ * drawn, and goes to the back when it is used. Two numbers give a deck's order:
+ *
+ * 		cursor 		Which of the deck's other cards is drawn next
+ * 		kept 		How many cards lie ahead of the kept card, or that it is held
+ *
+ * The decks only change when a card is drawn, so the chain steps from each draw to
+ * the next. A state of the chain is a draw about to be made:
+ *
+ * 		tile 		The Chance or Community Chest tile that the Player landed on
+ * 		rolls 		The rolls made this turn, if the Player rolls again after the
+ * 					draw (their last roll was 'doubles'), or 0 if the turn ends
+ * 		decks 		Each deck's cursor and kept card
+ *
+ * The card drawn in a state, and everything that it sets off (a move, a further
+ * draw from the other deck, an arrest), follow with certainty. The walk from there
+ * to the next draw depends on the dice alone (and on the kept cards held, which a
+ * detained Player uses), so the walks are worked out once, from every place that a
+ * Player can come to rest in, with the same rules as Simulator::simulateTurn():
+ * where and with how many rolls the next draw comes, which kept cards were used on
+ * the way (each goes to the back of its deck), and the expected landings on every
+ * Property. The classic board's chain has about 1.3 million states.
+ *
+ * Each state's expected landings up to the next draw, weighted by the chain's
+ * stationary distribution, give the share of all landings that each Property
+ * receives in the long run. The transitions are kept as a SparseMatrix (transposed,
+ * so that a product with it moves a distribution forward by one draw). The
+ * stationary distribution is found with BiCGSTAB, as the solution of (I - P')x = 0
+ * with one equation replaced by sum(x) = 1; should BiCGSTAB break down, power
+ * iteration takes over. Once the chain is large enough, products are spread across
+ * a pool of the configured number of threads, started once per solve (see
+ * 'lib/ThreadPool.h').
+ */
+
+#ifndef MARKOV_SOLVER_H
+#define MARKOV_SOLVER_H
+
+//Protected includes (for arguments and return types)
+#include <ostream>
+#include <vector>
+#include <utility>
+#include "SimulatorConfig.h"
+#include "Board.h"
+#include "BoardDefinition.h"
+#include "Player.h"
+#include "CardDecks.h"
+#include "lib/SparseMatrix.h"
+#include "lib/Solvers.h"
+
+class MarkovSolver {
+
+public:
+
+	//Jail states: free, or detained having served 0 to MAXIMUM_JAIL_SENTENCE turns
+	static const int JAIL_STATES = Player::MAXIMUM_JAIL_SENTENCE + 2;
+	//Rolls made this turn by a Player who rolls again: 0 (none; a new turn), 1 or 2
+	static const int ROLL_STATES = 3;
+	//Hands: one bit per deck, set while the Player holds that deck's kept card
+	static const int HAND_STATES = 1 << CardDecks::DECK_COUNT;
+	//Boards with more possible states than this are refused with a length_error
+	static const int MAXIMUM_STATES = 1 << 22;
+	//The walks between draws are iterated until no value changes by this much more
+	static constexpr double WALK_TOLERANCE = 1e-14;
+
+	//Solvers stop once the residual falls below TOLERANCE
+	static constexpr double TOLERANCE = 1e-12;
+	static const int MAXIMUM_ITERATIONS = 100000;
+
+	//Methods of finding the stationary distribution
+	enum Method { BICGSTAB, POWER_ITERATION };
+
+	//MarkovSolver class constructor
+	MarkovSolver(SimulatorConfig config);
+	//MarkovSolver class destructor
+	~MarkovSolver();
+
+	void runSimulation();
+	void solve(Method method = BICGSTAB);
+
+	//Accessor methods
+	int threadCount() const { return this->thread_count_; }
+	int stateCount() const { return (int)this->states_.size(); }
+	int transitionCount() const { return this->transposed_.nonZeros(); }
+	Method method() const { return this->method_; }
+	int iterations() const { return this->result_.iterations; }
+	double residual() const { return this->result_.residual; }
+	double landingProbability(int n) const;
+	void printPropertyStatistics(ostream& output) const;
+
+private:
+
+	/* Where a Player comes to rest between rolls (see ROLL_STATES) */
+	struct Position {
+		int location;
+		int jail;
+		int rolls;
+		int hand;
+	};
+
+	/* The order of each deck: its cursor, and its kept card's place (see above) */
+	struct Decks {
+		int cursor[CardDecks::DECK_COUNT];
+		int kept[CardDecks::DECK_COUNT];
+	};
+
+	/*** Private member variables ***/
+
+	SimulatorConfig config_;
+	int thread_count_;
+	shared_ptr<const BoardDefinition> definition_;
+
+	//Each deck's number of cards besides its kept card, and the places of its
+	//cursor, and of its kept card: ahead of 0 to all of them, or held (or only 1
+	//place, for a deck without one)
+	int others_[CardDecks::DECK_COUNT];
+	int cursor_places_[CardDecks::DECK_COUNT];
+	int kept_places_[CardDecks::DECK_COUNT];
+	int deck_orders_;
+	//The Chance and Community Chest tiles, and each tile's index among them (or -1)
+	vector<int> draw_tiles_;
+	int draw_index_[Board::MAXIMUM_SIZE];
+
+	//The walk from each Position to the next draw (see walkWidth())
+	vector<double> walks_;
+
+	//Reachable states, and each state's row (or -1 if unreachable), by encoded state
+	vector<int> states_;
+	vector<int> rows_;
+	//Transitions between rows (transposed: entry (to, from))
+	SparseMatrix transposed_;
+
+	Method method_;
+	Solvers::Result result_;
+	double probabilities_[Board::MAXIMUM_SIZE];
+
+	/*** Private method implementation ***/
+
+	void checkDecks() const;
+	void buildWalks();
+	void buildChain();
+	int rowOf(int state);
+
+	int deckAt(int location) const;
+	int walkWidth() const;
+	int drawColumn(int location, int rolls, int hand) const;
+	int positionIndex(const Position& position) const;
+	int encode(const Decks& decks) const;
+	Decks decode(int order) const;
+	int handOf(const Decks& decks) const;
+
+	//Turn logic, from a Position to the next roll's outcomes, or from a draw on
+	void roll(Position position, vector<pair<int, double> >& steps, double* walk);
+	Position draw(int draw, Decks& decks, double* landings, double weight) const;
+	Position arrest(const Position& position, double* landings, double probability) const;
+
+};
+
+#endif
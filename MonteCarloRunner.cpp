@@ -0,0 +1,193 @@
+/**
+ * @file MonteCarloRunner.cpp
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Contains implementation of the public interface and private methods of
+ * the MonteCarloRunner class. For details about this class, see 'MonteCarloRunner.h'.
+ */
+
+//Protected includes
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <ostream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+//Class header include
+#include "MonteCarloRunner.h"
+
+//Class dependencies
+#include "SimulatorConfig.h"
+#include "Board.h"
+#include "BatchSimulator.h"
+
+using namespace std;
+
+/*** Public interface implementation ***/
+
+/**
+ * MonteCarloRunner class constructor. Accepts an existing SimulatorConfig object
+ * describing the simulation parameters, including the number of worker threads.
+ *
+ * @param 	config 	An existing SimulatorConfig object
+ */
+MonteCarloRunner::MonteCarloRunner(SimulatorConfig config) : config_(config), definition_(config.board()) {
+	this->thread_count_ = this->config_.threadCount();
+	if(this->thread_count_ == 0) {
+		//Use every core (hardware_concurrency() may not know, and return 0)
+		this->thread_count_ = thread::hardware_concurrency();
+		if(this->thread_count_ == 0) {
+			this->thread_count_ = 1;
+		}
+	}
+	for(int w = 0; w < this->thread_count_; w++) {
+		this->workers_.push_back(new Worker());
+	}
+	for(int i = 0; i < this->definition_->size(); i++) {
+		this->counts_[i] = 0;
+	}
+}
+
+/* MonteCarloRunner class destructor. Deallocates the workers' state. */
+MonteCarloRunner::~MonteCarloRunner() {
+	for(unsigned int w = 0; w < this->workers_.size(); w++) {
+		delete this->workers_[w];
+	}
+}
+
+/* Simulates every configured game and records the resulting statistics */
+void MonteCarloRunner::runSimulation() {
+	this->simulateGames(this->config_.firstGame(), this->config_.gameCount());
+	//Record Property statistics once the simulation completes
+	ofstream output_handle;
+	output_handle.open(this->config_.outputPath().c_str(), ofstream::out | ofstream::trunc);
+	if(!output_handle.is_open()) {
+		throw runtime_error("Exception occured when opening a file for writing.\n\n");
+	}
+	output_handle << "Num Players: " << this->config_.playerCount() << " ";
+	output_handle << "Turns: " << this->config_.turnCount() << "\n";
+	output_handle << "Games: " << this->config_.gameCount() << "\n";
+	this->printPropertyStatistics(output_handle);
+	output_handle << "\n";
+}
+
+/**
+ * Simulates a contiguous range of games on the worker threads and adds their
+ * landing counts to the running totals. An exception thrown by any worker is
+ * rethrown here, on the calling thread, once every worker has stopped.
+ *
+ * @param 	first_game 	The index of the first game to simulate
+ * @param 	game_count 	The number of games to simulate
+ */
+void MonteCarloRunner::simulateGames(int first_game, int game_count) {
+	//Deal the chunks out evenly; each worker gets a contiguous run of them
+	int chunk_count = (game_count + BatchSimulator::LANES - 1) / BatchSimulator::LANES;
+	for(int w = 0; w < this->thread_count_; w++) {
+		Worker& worker = *(this->workers_[w]);
+		worker.chunks.clear();
+		for(int c = chunk_count * w / this->thread_count_;
+			c < chunk_count * (w + 1) / this->thread_count_; c++) {
+			worker.chunks.push_back(c);
+		}
+		for(int i = 0; i < this->definition_->size(); i++) {
+			worker.counts[i] = 0;
+		}
+		worker.error = nullptr;
+	}
+	//The calling thread doubles as worker 0
+	vector<thread> threads;
+	for(int w = 1; w < this->thread_count_; w++) {
+		threads.push_back(thread(&MonteCarloRunner::work, this, w, first_game, game_count));
+	}
+	this->work(0, first_game, game_count);
+	for(unsigned int t = 0; t < threads.size(); t++) {
+		threads[t].join();
+	}
+	//Report the first worker's failure, if any, leaving the totals untouched
+	for(int w = 0; w < this->thread_count_; w++) {
+		if(this->workers_[w]->error) {
+			rethrow_exception(this->workers_[w]->error);
+		}
+	}
+	//Merge the workers' private counts
+	for(int w = 0; w < this->thread_count_; w++) {
+		for(int i = 0; i < this->definition_->size(); i++) {
+			this->counts_[i] += this->workers_[w]->counts[i];
+		}
+	}
+}
+
+/* Returns the total number of landings on the nth Property, over all games */
+unsigned long long MonteCarloRunner::landingCount(int n) const {
+	return this->counts_[Board::wrapIndex(n, 0, this->definition_->size() - 1)];
+}
+
+/* Outputs 'landed on' statistics for all Properties on the Board */
+void MonteCarloRunner::printPropertyStatistics(ostream& output) const {
+	output << "\n";
+	for(int i = 0; i < this->definition_->size(); i++) {
+		output << this->definition_->tileName(i) << " :: " << this->counts_[i] << "\n";
+	}
+}
+
+/*** Private method implementation ***/
+
+/**
+ * Worker thread body. Plays chunks on a private BatchSimulator until there are
+ * none left to take or steal, then publishes its counts. An exception stops the
+ * worker and is kept for simulateGames() to rethrow; it must not escape a thread.
+ *
+ * @param 	worker 		The index of this worker
+ * @param 	first_game 	The index of the first game in chunk 0
+ * @param 	game_count 	The total number of games being simulated
+ */
+void MonteCarloRunner::work(int worker, int first_game, int game_count) {
+	Worker& self = *(this->workers_[worker]);
+	try {
+		BatchSimulator batch(this->config_);
+		int chunk;
+		while(this->nextChunk(worker, chunk)) {
+			int first = chunk * BatchSimulator::LANES;
+			int count = (game_count - first < BatchSimulator::LANES) ? game_count - first : BatchSimulator::LANES;
+			batch.simulateGames(first_game + first, count);
+		}
+		for(int i = 0; i < this->definition_->size(); i++) {
+			self.counts[i] = batch.landingCount(i);
+		}
+	} catch(...) {
+		self.error = current_exception();
+	}
+}
+
+/**
+ * Takes the next chunk from the back of a worker's own deque or, failing that,
+ * steals one from the front of another worker's deque. Returns false once every
+ * deque is empty.
+ *
+ * @param 	worker 	The index of the worker looking for work
+ * @param 	chunk 	Set to the index of the chunk taken
+ */
+bool MonteCarloRunner::nextChunk(int worker, int& chunk) {
+	{
+		Worker& self = *(this->workers_[worker]);
+		lock_guard<mutex> guard(self.lock);
+		if(!self.chunks.empty()) {
+			chunk = self.chunks.back();
+			self.chunks.pop_back();
+			return true;
+		}
+	}
+	for(int v = 1; v < this->thread_count_; v++) {
+		Worker& victim = *(this->workers_[(worker + v) % this->thread_count_]);
+		lock_guard<mutex> guard(victim.lock);
+		if(!victim.chunks.empty()) {
+			chunk = victim.chunks.front();
+			victim.chunks.pop_front();
+			return true;
+		}
+	}
+	return false;
+}
@@ -0,0 +1,76 @@
+/**
+ * @file MonteCarloRunner.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Describes the public interface and private methods of the MonteCarloRunner
+ * class. The runner spreads a range of independent games across a pool of worker
+ * threads. Games are cut into chunks of BatchSimulator::LANES games; each worker
+ * starts with an even share of the chunks in its own deque, takes work from the
+ * back of its deque, and steals from the front of another worker's deque once its
+ * own runs dry. Every worker plays its chunks on a private BatchSimulator and
+ * keeps its landing counts in a private, cache-line-aligned buffer; the buffers
+ * are merged once all workers finish.
+ *
+ * Because every game draws from its own random streams, the merged counts are the
+ * same no matter how many threads run or which worker ends up playing which game.
+ */
+
+#ifndef MONTE_CARLO_RUNNER_H
+#define MONTE_CARLO_RUNNER_H
+
+//Protected includes (for arguments and return types)
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <ostream>
+#include <vector>
+#include "SimulatorConfig.h"
+#include "Board.h"
+#include "BoardDefinition.h"
+
+class MonteCarloRunner {
+
+public:
+
+	//MonteCarloRunner class constructor
+	MonteCarloRunner(SimulatorConfig config);
+	//MonteCarloRunner class destructor
+	~MonteCarloRunner();
+
+	void runSimulation();
+	void simulateGames(int first_game, int game_count);
+
+	//Accessor methods
+	int threadCount() const { return this->thread_count_; }
+	unsigned long long landingCount(int n) const;
+	void printPropertyStatistics(ostream& output) const;
+
+private:
+
+	/* Per-thread state; aligned so that no two workers share a cache line */
+	struct alignas(64) Worker {
+		mutex lock;
+		deque<int> chunks;
+		unsigned long long counts[Board::MAXIMUM_SIZE];
+		//Set if the worker stopped on an exception, to be rethrown by the caller
+		exception_ptr error;
+	};
+
+	/*** Private member variables ***/
+
+	SimulatorConfig config_;
+	int thread_count_;
+	shared_ptr<const BoardDefinition> definition_;
+
+	vector<Worker*> workers_;
+	unsigned long long counts_[Board::MAXIMUM_SIZE];
+
+	/*** Private method implementation ***/
+
+	void work(int worker, int first_game, int game_count);
+	bool nextChunk(int worker, int& chunk);
+
+};
+
+#endif
@@ -9,71 +9,62 @@
  * Property index), his citizen status (in-jail or out-of-jail), as well as a small
  * Card queue to store any Get-Out-Of-Jail cards which the Player draws from either
  * deck ('Community Chest' or 'Chance').
+ *
+ * Apart from its id, a Player's state is a packed PlayerState (see 'GameState.h'),
+ * the same 16 bits that the BatchSimulator keeps for each Player of each lane.
  */
 
 #ifndef PLAYER_H
 #define PLAYER_H
 
+//Protected includes
+#include "GameState.h"
+#include "CardDecks.h"
+
 class Player {
 
 public:
 
-	static const int MAXIMUM_JAIL_SENTENCE = 2;
-
-	bool hasGetOutOfJailChance;
-	bool hasGetOutOfJailCommunityChest;
+	static const int MAXIMUM_JAIL_SENTENCE = PlayerState::MAXIMUM_JAIL_SENTENCE;
 
 	/**
-	 * Player class constructor. Takes a seed with which to seed the Player's own random
-	 * number generator (which should stay in sync across all Players), as well as a
-	 * reference to a shared ofstream object which a Player uses to record their turns.
+	 * Player class constructor. The Player starts out free, on 'Go', holding no cards.
 	 *
-	 * @param 	seed 			A seed provided by the Simulator object
-	 * @param 	output_channel 	A reference to an ofstream provided by the Simulator object
+	 * @param 	id 	The Player's index in the game
 	 */
-	Player(unsigned int id)
-	: id_(id),
-	  location_(0),
-	  detained_(false),
-	  turns_in_jail_(0),
-	  hasGetOutOfJailChance(false),
-	  hasGetOutOfJailCommunityChest(false) { }
+	Player(unsigned int id) : id_(id) { }
 	
 	//Player class destructor
 	~Player() { }
 
 	//Accessor methods
 	unsigned int getId() { return this->id_; }
-	int getLocation()    { return this->location_; }
-	bool isDetained()      { return this->detained_; }
-	int getTurnsInJail() { return this->turns_in_jail_; }
+	int getLocation()    { return this->state_.location(); }
+	bool isDetained()      { return this->state_.isDetained(); }
+	int getTurnsInJail() { return this->state_.turnsInJail(); }
+	bool hasGetOutOfJailCard(CardDecks::Deck deck) { return this->state_.hasGetOutOfJailCard(deck); }
 
 	//Mutator methods
 	Player& setLocation(int n) {
-		this->location_ = n;
+		this->state_.setLocation(n);
 		return *this;
 	}
 	void setDetention(bool val) {
 		//Reset the Player's 'time served'
-		this->turns_in_jail_ = 0;
-		this->detained_ = val;
+		this->state_.setDetention(val);
 	}
 	void incrementTurnsInJail() {
-		if(this->detained_) {
-			this->turns_in_jail_++;
-		} else {
-			//No-op
-		}
+		this->state_.incrementTurnsInJail();
+	}
+	void setGetOutOfJailCard(CardDecks::Deck deck, bool held) {
+		this->state_.setGetOutOfJailCard(deck, held);
 	}
 	
 private:
 
 	unsigned int id_;
-	int location_;
-	bool detained_;
-	int turns_in_jail_;
+	PlayerState state_;
 
 };
 
 #endif
-
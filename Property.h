@@ -6,7 +6,13 @@
  * Describes the public interface and private methods of the Property class. This
  * class is designed to store the state of a single Property in a game of Monopoly.
  * A property has a name and a counter that tracks the numer of times that a player
- * has landed on the property.
+ * has landed on the property. Each property also carries a kind, which tells the
+ * Simulator how the property responds to a player that lands on it.
+ *
+ * Like a Card's description, a Property's name is not copied: it must outlive the
+ * Property. Boards are populated with the names held by their BoardDefinition (the
+ * classic board's are constexpr, see 'ClassicBoard.h'), so a Board is built without
+ * any string work.
  */
 
 #ifndef PROPERTY_H
@@ -26,19 +32,34 @@ class Property {
 
 public:
 
+	/* Property kinds; the name is only used for reporting */
+	enum Kind {
+		PLAIN,
+		RAILROAD,
+		UTILITY,
+		CHANCE,
+		COMMUNITY_CHEST,
+		GO_TO_JAIL,
+		JAIL 			//Where arrested Players are held (otherwise plain)
+	};
+
 	//Class constructor
-	Property(string name) : name_(name), count_(0) { }
+	Property(const char* name, Kind kind = Property::PLAIN)
+	: name_(name), kind_(kind), count_(0) { }
 
 	//Accessors methods
-	string name() { return this->name_; }
-	int count() { return this->count_; }
+	const char* name() const { return this->name_; }
+	Kind kind() const { return this->kind_; }
+	int count() const { return this->count_; }
 	
 	//Mutator methods
 	void incrementCount() { this->count_ += 1; }
+	void setCount(int count) { this->count_ = count; }
 
 private:
 
-	string name_;
+	const char* name_;
+	Kind kind_;
 	int count_;
 	
 };
@@ -0,0 +1,134 @@
+/**
+ * @file Random.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Describes and implements the RandomStream class, the simulation's source of
+ * random numbers. Each stream is counter-based: the nth random word of a stream
+ * is a pure function of (seed, game, stream, n), computed with the Philox4x32-10
+ * block function (Salmon et al., "Parallel Random Numbers: As Easy as 1, 2, 3").
+ * This means that:
+ *
+ * 		- every game, and every Player within a game, owns an independent stream;
+ * 		- a stream can jump ahead (or back) to any position in constant time;
+ * 		- the numbers a game sees never depend on how games are scheduled across
+ * 		  lanes, blocks or threads, so a given seed always reproduces bit-identical
+ * 		  results.
+ */
+
+#ifndef RANDOM_H
+#define RANDOM_H
+
+class RandomStream {
+
+public:
+
+	/**
+	 * RandomStream class constructor. Addresses the stream belonging to one
+	 * participant of one game, positioned at its first word.
+	 *
+	 * @param 	seed 	The simulation's seed
+	 * @param 	game 	The index of the game that owns the stream
+	 * @param 	stream 	The index of the stream within the game (e.g. a Player id)
+	 */
+	RandomStream(unsigned long long seed = 0, unsigned int game = 0, unsigned int stream = 0)
+	: game_(game), stream_(stream), position_(0), buffered_(~0ULL) {
+		this->key_[0] = (unsigned int)seed;
+		this->key_[1] = (unsigned int)(seed >> 32);
+	}
+
+	//Accessor methods
+
+	/* Returns the number of 32-bit words consumed so far */
+	unsigned long long position() const { return this->position_; }
+
+	//Mutator methods
+
+	/* Returns the next 32-bit word of the stream */
+	unsigned int nextInt() {
+		unsigned long long block = this->position_ >> 2;
+		if(block != this->buffered_) {
+			//Generate the block containing the current position
+			this->buffered_ = block;
+			this->generate(block, this->buffer_);
+		}
+		return this->buffer_[this->position_++ & 3];
+	}
+
+	/* Returns the next 64-bit word of the stream (two 32-bit words) */
+	unsigned long long next() {
+		unsigned long long low = this->nextInt();
+		return low | ((unsigned long long)this->nextInt() << 32);
+	}
+
+	/**
+	 * Returns an unbiased integer in the range [0, n), using Lemire's
+	 * multiply-and-reject method (no division on the common path).
+	 *
+	 * @param 	n 	The (positive) size of the range
+	 */
+	unsigned int nextBelow(unsigned int n) {
+		unsigned long long m = (unsigned long long)this->nextInt() * n;
+		if((unsigned int)m < n) {
+			unsigned int threshold = (0u - n) % n;
+			while((unsigned int)m < threshold) {
+				m = (unsigned long long)this->nextInt() * n;
+			}
+		}
+		return (unsigned int)(m >> 32);
+	}
+
+	/* Jumps the stream ahead by n 32-bit words */
+	void skip(unsigned long long n) { this->position_ += n; }
+
+	/* Moves the stream to an absolute position (in 32-bit words) */
+	void seek(unsigned long long position) { this->position_ = position; }
+
+	/**
+	 * Computes the four 32-bit words at the given block index of this stream.
+	 * The Philox counter is (block index, stream, game) and the key is the seed.
+	 *
+	 * @param 	block 	A block index; block b holds words [4b, 4b + 4)
+	 * @param 	out 	An array that receives the four words
+	 */
+	void generate(unsigned long long block, unsigned int out[4]) const {
+		RandomStream::philox(this->key_, (unsigned int)block, (unsigned int)(block >> 32),
+							 this->stream_, this->game_, out);
+	}
+
+	/* The Philox4x32-10 block function */
+	static void philox(const unsigned int key[2], unsigned int c0, unsigned int c1,
+					   unsigned int c2, unsigned int c3, unsigned int out[4]) {
+		unsigned int k0 = key[0], k1 = key[1];
+		for(int round = 0; round < 10; round++) {
+			unsigned long long p0 = (unsigned long long)0xD2511F53u * c0;
+			unsigned long long p1 = (unsigned long long)0xCD9E8D57u * c2;
+			unsigned int n0 = (unsigned int)(p1 >> 32) ^ c1 ^ k0;
+			unsigned int n2 = (unsigned int)(p0 >> 32) ^ c3 ^ k1;
+			c0 = n0;
+			c1 = (unsigned int)p1;
+			c2 = n2;
+			c3 = (unsigned int)p0;
+			k0 += 0x9E3779B9u;
+			k1 += 0xBB67AE85u;
+		}
+		out[0] = c0;
+		out[1] = c1;
+		out[2] = c2;
+		out[3] = c3;
+	}
+
+private:
+
+	unsigned int key_[2];
+	unsigned int game_;
+	unsigned int stream_;
+	unsigned long long position_;
+
+	//The most recently generated block, and its block index
+	unsigned long long buffered_;
+	unsigned int buffer_[4];
+
+};
+
+#endif
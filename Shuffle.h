@@ -0,0 +1,69 @@
+/**
+ * @file Shuffle.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Describes and implements the ShuffleStream class, the source of a game's deck
+ * shuffles. Each deck of each game owns a RandomStream of its own, numbered after
+ * the game's Player streams (see 'Dice.h'), so shuffling a deck never changes the
+ * dice, and a game's shuffles are the same whichever engine (or lane, or thread)
+ * plays it. A shuffle is an in-place Fisher-Yates pass over an array of card ids:
+ * one unbiased random number per card, and no allocation, so a deck can be
+ * shuffled at the start of every game of a large batch.
+ */
+
+#ifndef SHUFFLE_H
+#define SHUFFLE_H
+
+//Protected includes
+#include "Random.h"
+
+class ShuffleStream {
+
+public:
+
+	//The stream of a game's first deck; Player streams are numbered from 0
+	static const unsigned int FIRST_STREAM = 0x80000000u;
+
+	/**
+	 * ShuffleStream class constructor. Shuffles are drawn from the addressed stream.
+	 *
+	 * @param 	seed 	The simulation's seed
+	 * @param 	game 	The index of the game that owns the deck
+	 * @param 	deck 	The deck (a CardDecks::Deck)
+	 */
+	ShuffleStream(unsigned long long seed = 0, unsigned int game = 0, unsigned int deck = 0)
+	: random_(seed, game, FIRST_STREAM + deck) { }
+
+	//Accessor methods
+
+	/* Returns the number of 32-bit words used so far */
+	unsigned long long position() const { return this->random_.position(); }
+
+	//Mutator methods
+
+	/* Moves the stream to a position reported by position() */
+	void seek(unsigned long long position) { this->random_.seek(position); }
+
+	/**
+	 * Shuffles an array in place, so that each of its orderings is equally likely.
+	 *
+	 * @param 	items 	The array (e.g. a deck's card ids, front first)
+	 * @param 	count 	The number of items in the array
+	 */
+	template<class T> void shuffle(T* items, int count) {
+		for(int i = count - 1; i > 0; i--) {
+			int j = (int)this->random_.nextBelow(i + 1);
+			T item = items[i];
+			items[i] = items[j];
+			items[j] = item;
+		}
+	}
+
+private:
+
+	RandomStream random_;
+
+};
+
+#endif
@@ -8,12 +8,10 @@
  */
 
 //Protected includes
-#include <cstdlib>
-#include <ctime>
 #include <string>
 #include <vector>
+#include <climits>
 #include <sstream>
-#include <fstream>
 #include <stdexcept>
 
 #include <iostream>
@@ -24,12 +22,20 @@
 //Class dependencies
 #include "SimulatorConfig.h"
 #include "Board.h"
+#include "BoardDefinition.h"
+#include "Property.h"
 #include "Player.h"
-#include "lib/Queue.h"
+#include "lib/Arena.h"
+#include "lib/AsyncFileBuffer.h"
+#include "lib/Ring.h"
 #include "Card.h"
-
-//Include namespace containing Property and Card action functions
-#include "CardActions.h"
+#include "CardDecks.h"
+#include "Dice.h"
+#include "SimulatorEvents.h"
+#include "TextObserver.h"
+#include "Trace.h"
+#include "StatsObserver.h"
+#include "Checkpoint.h"
 
 using namespace std;
 
@@ -41,453 +47,553 @@ using namespace std;
 *
 * @param 	config 	An existing SimulatorConfig object
 */
-Simulator::Simulator(SimulatorConfig config) : config_(config) {
-	//Seed the random number generator, if a seed was specified
-	if(this->config_.hasSeed()) {
-		srand(this->config_.seed());
-	}
-	//Clear the contents of the output file, if it exists
-	this->clearOutput();
+Simulator::Simulator(SimulatorConfig config)
+: config_(config), output_handle_(&this->output_buffer_), definition_(config.board()), rounds_played_(0),
+  shares_(config.board()->size()) {
+	//Use the specified seed, or the current time if none was given
+	this->seed_ = this->config_.resolvedSeed();
+	//Create the output file (clearing its contents, if it exists)
+	this->output_buffer_.open(this->config_.outputPath());
 	//Print config summary
 	this->printConfigSummary();
-	//Conditional output until reporting of Property statistics
-	this->allowOutput(this->config_.isVerbose());
+	//Set up the Board and the decks
+	this->populateBoard();
+	this->populateDecks();
+	for(int i = 0; i < this->board_.size(); i++) {
+		this->batch_start_[i] = 0;
+	}
 }
 
 /**
- * Simulator class destructor. Closes the output file handler and
- * deallocates all Player objects on the heap.
+ * Simulator class destructor. Closes the output file, once all of the output
+ * has been written. The Player objects are released along with the
+ * Simulator's arena.
  */
 Simulator::~Simulator() {
-	//Close the output file handler
-	this->output_handle_ << "\n";
-	this->output_handle_.close();
-	//Delete Player objects allocated on the heap
-	for(unsigned int i = 0; i < this->players_.size(); i++) {
-		delete this->players_[i];
+	//Close the output file handler, unless runSimulation() already has
+	if(this->output_buffer_.is_open()) {
+		this->output_handle_ << "\n";
 	}
 }
 
-/* Simulation loop. Simulates player turns and outputs simulation results. */
+/**
+ * Simulation loop. Simulates player turns and outputs simulation results. In
+ * verbose mode, every event is written to the output file as text, or to a
+ * binary trace if one was requested; otherwise the events are ignored, and
+ * never formatted. With '--stats', the events are also counted, and the counts
+ * and phase timers are printed to standard output once the run ends.
+ *
+ * The output files are closed once the run ends, and a runtime_error is thrown
+ * if any of their output couldn't be written.
+ */
 void Simulator::runSimulation() {
-	
-	this->populateBoard();
-	this->populateChanceDeck();
-	this->populateCommunityChestDeck();
+	if(this->config_.hasStats()) {
+		StatsObserver stats;
+		if(this->config_.isTraced()) {
+			TraceWriter writer(this->config_.tracePath(), this->config_);
+			ObserverPair<TraceWriter, StatsObserver> observer(writer, stats);
+			this->runSimulation(observer);
+			writer.close();
+		} else
+		if(this->config_.isVerbose()) {
+			TextObserver text(this->output_handle_);
+			ObserverPair<TextObserver, StatsObserver> observer(text, stats);
+			this->runSimulation(observer);
+		} else {
+			this->runSimulation(stats);
+		}
+		this->closeOutput();
+		stats.print(cout);
+		return;
+	}
+	if(this->config_.isTraced()) {
+		TraceWriter observer(this->config_.tracePath(), this->config_);
+		this->runSimulation(observer);
+		observer.close();
+	} else
+	if(this->config_.isVerbose()) {
+		TextObserver observer(this->output_handle_);
+		this->runSimulation(observer);
+	} else {
+		NullObserver observer;
+		this->runSimulation(observer);
+	}
+	this->closeOutput();
+}
+
+/**
+ * Simulation loop. Simulates player turns, reporting each event of the game
+ * to the given observer, and outputs the resulting Property statistics.
+ *
+ * @param 	observer 	An observer (see 'SimulatorEvents.h')
+ */
+template<class Observer> void Simulator::runSimulation(Observer& observer) {
 
 	//Generate the Players to act out our simulation
 	for(unsigned int i = 0; i < this->config_.playerCount(); i++) {
-		//Create a new Player object, passing it a reference to our Board,
-		//the seed, and a reference to the output stream
-		this->players_.push_back(new Player(i));
+		//Create a new Player object in the Simulator's arena
+		this->players_.push_back(this->arena_.create<Player>(i));
+		//Each Player rolls from their own stream of this game's random numbers
+		this->dice_.push_back(DiceStream(this->seed_, this->config_.firstGame(), i));
 	}
 	
+	//Continue from a checkpoint, if asked to
+	unsigned int first_round = 0;
+	if(this->config_.isResumed()) {
+		this->restoreCheckpoint(this->config_.resumePath());
+		first_round = this->rounds_played_;
+	}
+
 	//Simulate the game loop for the number of turn (rounds) specified by the user
-	for(unsigned int r_index = 0; r_index < this->config_.turnCount(); r_index++) {
+	for(unsigned int r_index = first_round; r_index < this->config_.turnCount(); r_index++) {
 		//For each round (turn set) of the simulation
-		this->printRoundLabel(r_index);
+		observer.notify(RoundEvent{ (int)r_index });
 		for(unsigned int p_index = 0; p_index < this->config_.playerCount(); p_index++) {			
 			//For each participating Player
 			Player& player = *(this->players_[p_index]);
 			//State where the player currently resides
-			this->output_handle_ << "Player " << player.getId() << " starting on ";
-			string current = this->board_.propertyAt(player.getLocation()).name();
-			this->output_handle_ << current << "\n";
-			//Recursive 'move' method
-			this->simulateTurn(player);
+			observer.notify(TurnEvent{ (int)player.getId(), this->board_.propertyAt(player.getLocation()) });
+			//Play out the Player's turn
+			this->simulateTurn(player, observer);
+		}
+		this->rounds_played_ = r_index + 1;
+		//Stop early once the estimates are precise enough, if asked to
+		if(this->config_.isConvergent() && this->hasConverged(this->rounds_played_)) {
+			break;
+		}
+		//Save the game's state periodically, if asked to
+		if(this->config_.isCheckpointed() && this->rounds_played_ % this->config_.checkpointInterval() == 0) {
+			this->saveCheckpoint(this->config_.checkpointPath());
 		}
 	}
+	//The final state is saved too, so that the run can later be extended
+	if(this->config_.isCheckpointed() && this->rounds_played_ % this->config_.checkpointInterval() != 0) {
+		this->saveCheckpoint(this->config_.checkpointPath());
+	}
 	
 	//Record Property statistics once the simulation completes
 	this->printPropertyStatistics();
 
 }
 
-/**
- * This public is necessary, in fitting with my program's poor design, to allow
- * subsequent Property actions occur after a Player lands on a 'Chance' or
- * 'Community Chest' space (specifically, to allow Players to pick up a 'Community
- * Chest' card after landing on a 'Chance' space and drawing 'Go back three spaces')
- *
- * @param 	player 	A reference to a Player object
- * @param 	n 		A Property index
- */
-void Simulator::advancePlayerTo(Player& player, int n) {
-	Property& destination = this->board_.propertyAt(n);
-	player.setLocation(this->board_.indexOf(destination));
-	//Report the Player's move
-	this->output_handle_ << "Player " << player.getId() << " landed on ";
-	this->output_handle_ << destination.name() << "\n";
-	//Increase the destination Property's counter
-	destination.incrementCount();
-	//Have the Property respond to the Player if necessary
-	if(destination.name() == "Go To Jail") {
-		this->arrestPlayer(player);
-	} else
-	if(destination.name() == "Chance") {
-		this->drawChance(player);
-	} else
-	if(destination.name() == "Community Chest") {
-		this->drawCommunityChest(player);
-	}
-}
+/*** Private method implementation ***/
 
-/* Moves a Player to the Jail, updating that Player's state */
-void Simulator::arrestPlayer(Player& player) {
-	player.setLocation(Board::JAIL_LOCATION);
-	this->board_.propertyAt(Board::JAIL_LOCATION).incrementCount();
-	player.setDetention(true);
-	//Report the arrest
-	this->output_handle_ << " -> Player " << player.getId() << " is hauled off to Jail!\n";
+/* Ends the output file and closes it, throwing a runtime_error if any of it couldn't be written */
+void Simulator::closeOutput() {
+	this->output_handle_ << "\n";
+	this->output_buffer_.close();
 }
 
-/*** Private method implementation ***/
+void Simulator::populateBoard() {
+	//Populate the Board with the definition's Properties
+	this->board_.populate(*this->definition_);
+}
 
-/* Toggles program output. Redirects unwanted output to /dev/null */
-void Simulator::allowOutput(bool allow) {
-	if(this->output_handle_.is_open()) {
-		this->output_handle_.close();
-	}
-	if(!allow) {
-		this->output_handle_.open("/dev/null");
-	} else {
-		try {
-			this->output_handle_.open(this->getOutputPath().c_str(),
-									  ofstream::out | ofstream::app);
-		} catch(const ofstream::failure &e) {
-			throw runtime_error("Exception occured when opening a file for writing.\n\n");
+void Simulator::populateDecks() {
+	//Stack each deck with its cards' ids, in order, then shuffle it unless asked not to
+	for(int d = 0; d < CardDecks::DECK_COUNT; d++) {
+		for(int id = 0; id < this->definition_->deckSize((CardDecks::Deck)d); id++) {
+			this->decks_[d].push(id);
+		}
+		this->shuffles_[d] = ShuffleStream(this->seed_, this->config_.firstGame(), d);
+		this->undrawn_[d] = this->decks_[d].size();
+		if(this->config_.shufflePolicy() != CardDecks::UNSHUFFLED) {
+			this->shuffleDeck((CardDecks::Deck)d);
 		}
 	}
 }
 
-/* Clears the text contents of the output file */
-void Simulator::clearOutput() {
-	if(this->output_handle_.is_open()) {
-		this->output_handle_.close();
+/* Shuffles the cards left in a deck, and counts them as undrawn */
+void Simulator::shuffleDeck(CardDecks::Deck deck) {
+	int ids[CardDecks::MAXIMUM_DECK_SIZE];
+	int count = this->decks_[deck].size();
+	for(int c = 0; c < count; c++) {
+		ids[c] = this->decks_[deck].front();
+		this->decks_[deck].pop();
 	}
-	try {
-		this->output_handle_.open(this->getOutputPath().c_str(),
-								  ofstream::out | ofstream::trunc);
-	} catch(const ofstream::failure &e) {
-		throw runtime_error("Exception occured when opening a file for writing.\n\n");
+	this->shuffles_[deck].shuffle(ids, count);
+	for(int c = 0; c < count; c++) {
+		this->decks_[deck].push(ids[c]);
 	}
+	this->undrawn_[deck] = count;
 }
 
-void Simulator::populateBoard() {
-	//Populate the Board with Monopoly properties	
-	this->board_.addProperty(*(new Property("Go")));
-	this->board_.addProperty(*(new Property("Mediterranean Avenue")));
-	this->board_.addProperty(*(new Property("Community Chest")));
-	this->board_.addProperty(*(new Property("Baltic Avenue")));
-	this->board_.addProperty(*(new Property("Income Tax")));
-	this->board_.addProperty(*(new Property("Reading Railroad")));
-	this->board_.addProperty(*(new Property("Oriental Avenue")));
-	this->board_.addProperty(*(new Property("Chance")));
-	this->board_.addProperty(*(new Property("Vermont Avenue")));
-	this->board_.addProperty(*(new Property("Connecticut Avenue")));
-	this->board_.addProperty(*(new Property("In Jail/Just Visiting")));
-	this->board_.addProperty(*(new Property("St. Charles Place")));
-	this->board_.addProperty(*(new Property("Electric Company")));
-	this->board_.addProperty(*(new Property("States Avenue")));
-	this->board_.addProperty(*(new Property("Virginia Avenue")));
-	this->board_.addProperty(*(new Property("Pennsylvania Railroad")));
-	this->board_.addProperty(*(new Property("St. James Place")));
-	this->board_.addProperty(*(new Property("Community Chest")));
-	this->board_.addProperty(*(new Property("Tennessee Avenue")));
-	this->board_.addProperty(*(new Property("New York Avenue")));
-	this->board_.addProperty(*(new Property("Free Parking")));
-	this->board_.addProperty(*(new Property("Kentucky Avenue")));
-	this->board_.addProperty(*(new Property("Chance")));
-	this->board_.addProperty(*(new Property("Indiana Avenue")));
-	this->board_.addProperty(*(new Property("Illinois Avenue")));
-	this->board_.addProperty(*(new Property("B. & O. Railroad")));
-	this->board_.addProperty(*(new Property("Alantic Avenue")));
-	this->board_.addProperty(*(new Property("Ventnor Avenue")));
-	this->board_.addProperty(*(new Property("Water Works")));
-	this->board_.addProperty(*(new Property("Marvin Gardens")));
-	this->board_.addProperty(*(new Property("Go To Jail")));
-	this->board_.addProperty(*(new Property("Pacific Avenue")));
-	this->board_.addProperty(*(new Property("North Carolina AVenue")));
-	this->board_.addProperty(*(new Property("Community Chest")));
-	this->board_.addProperty(*(new Property("Pennsylvania Avenue")));
-	this->board_.addProperty(*(new Property("Short Line")));
-	this->board_.addProperty(*(new Property("Chance")));
-	this->board_.addProperty(*(new Property("Park Place")));
-	this->board_.addProperty(*(new Property("Luxury Tax")));
-	this->board_.addProperty(*(new Property("Boardwalk")));
-}
+/**
+ * Simulates a Player's turn, from their first dice roll until they come to
+ * rest. The turn is an explicit state machine rather than a recursion: each
+ * pass through the loop handles one state and picks the next one.
+ *
+ * 		PRE_ROLL 		Use a 'Get Out of Jail Free' card if detained, and roll
+ * 		JAIL 			A detained Player rolled; released on doubles or after
+ * 						MAXIMUM_JAIL_SENTENCE turns, otherwise the turn ends
+ * 		ROLLED 			A free Player rolled; moves, or is arrested on their third
+ * 						'doubles' in a row
+ * 		MOVED 			The Player arrives at 'destination', and the Property
+ * 						responds; a card that moves the Player comes back here
+ * 		CARD_RESOLVED 	The Player is at rest; followed cards return to their
+ * 						decks, and 'doubles' earn another roll unless the Player
+ * 						ended up in Jail
+ * 		DONE 			The turn is over
+ *
+ * A card leaves its deck when drawn and returns to the back of the deck once
+ * the Player comes to rest, so a chain of cards returns most recent first.
+ *
+ * @param 	player 		A reference to a Player object
+ * @param 	observer 	The observer to report the turn's events to
+ */
+template<class Observer> void Simulator::simulateTurn(Player& player, Observer& observer) {
+
+	TurnState state = PRE_ROLL;
+	int rolls = 0;
+	int die1 = 0, die2 = 0;
+	int destination = 0;
+	//Cards being followed, and the decks that they return to
+	CardDecks::Deck held_deck[CardDecks::DECK_COUNT * CardDecks::MAXIMUM_DECK_SIZE];
+	int held_id[CardDecks::DECK_COUNT * CardDecks::MAXIMUM_DECK_SIZE];
+	int held = 0;
+
+	while(state != DONE) {
+		switch(state) {
+
+			case PRE_ROLL:
+				//Check whether the Player is in Jail and may use a Get Out of Jail Free card
+				if(player.isDetained()) {
+					observer.notify(PhaseEvent{ PhaseEvent::JAIL });
+					if(player.hasGetOutOfJailCard(CardDecks::CHANCE_DECK)) {
+						//'Remove' the card from the Player's hand, and 'return' it to the deck
+						player.setGetOutOfJailCard(CardDecks::CHANCE_DECK, false);
+						this->releasePlayer(player, ReleaseEvent::GET_OUT_OF_JAIL_FREE, observer);
+						this->decks_[CardDecks::CHANCE_DECK].push(this->definition_->keptCard(CardDecks::CHANCE_DECK));
+					} else
+					if(player.hasGetOutOfJailCard(CardDecks::COMMUNITY_CHEST_DECK)) {
+						//'Remove' the card from the Player's hand, and 'return' it to the deck
+						player.setGetOutOfJailCard(CardDecks::COMMUNITY_CHEST_DECK, false);
+						this->releasePlayer(player, ReleaseEvent::GET_OUT_OF_JAIL_FREE, observer);
+						this->decks_[CardDecks::COMMUNITY_CHEST_DECK].push(this->definition_->keptCard(CardDecks::COMMUNITY_CHEST_DECK));
+					}
+				}
+				//Simulate the Player's dice roll
+				observer.notify(PhaseEvent{ PhaseEvent::DICE });
+				die1 = this->getDiceRoll(player);
+				die2 = this->getDiceRoll(player);
+				rolls++;
+				observer.notify(RollEvent{ (int)player.getId(), die1, die2 });
+				state = player.isDetained() ? JAIL : ROLLED;
+				break;
+
+			case JAIL:
+				observer.notify(PhaseEvent{ PhaseEvent::JAIL });
+				if(die1 == die2 || player.getTurnsInJail() >= Player::MAXIMUM_JAIL_SENTENCE) {
+					//Let the Player advance according to their roll
+					this->releasePlayer(player, (die1 == die2) ? ReleaseEvent::DOUBLES : ReleaseEvent::SENTENCE_SERVED, observer);
+					destination = this->board_.wrap(player.getLocation() + die1 + die2);
+					state = MOVED;
+				} else {
+					observer.notify(StayEvent{ (int)player.getId() });
+					player.incrementTurnsInJail();
+					state = DONE;
+				}
+				break;
+
+			case ROLLED:
+				observer.notify(PhaseEvent{ PhaseEvent::MOVEMENT });
+				if(die1 == die2 && rolls >= 3) {
+					//The Player has rolled 'doubles' three times in a row. As per Monopoly
+					//rules, they are sent to jail!
+					this->arrestPlayer(player, ArrestEvent::THIRD_DOUBLES, observer);
+					state = DONE;
+				} else {
+					destination = this->board_.wrap(player.getLocation() + die1 + die2);
+					state = MOVED;
+				}
+				break;
+
+			case MOVED: {
+				//Have the Property respond to the Player if necessary
+				observer.notify(PhaseEvent{ PhaseEvent::TILE });
+				Property::Kind kind = this->landOn(player, destination, observer);
+				state = CARD_RESOLVED;
+				if(kind == Property::GO_TO_JAIL) {
+					this->arrestPlayer(player, ArrestEvent::GO_TO_JAIL_PROPERTY, observer);
+				} else
+				if(kind == Property::CHANCE || kind == Property::COMMUNITY_CHEST) {
+					CardDecks::Deck deck = (kind == Property::CHANCE) ? CardDecks::CHANCE_DECK : CardDecks::COMMUNITY_CHEST_DECK;
+					observer.notify(PhaseEvent{ PhaseEvent::CARDS });
+					int id = this->drawCard(deck, player, observer);
+					const Card& card = this->definition_->card(deck, id);
+					if(card.effect() != Card::KEEP_CARD) {
+						held_deck[held] = deck;
+						held_id[held] = id;
+						held++;
+						state = this->followCard(card, player, destination, observer);
+					}
+				}
+				break;
+			}
+
+			case CARD_RESOLVED:
+				//Return the followed cards to the back of their decks
+				while(held > 0) {
+					held--;
+					this->decks_[held_deck[held]].push(held_id[held]);
+				}
+				//Landing in Jail loses you your right to re-roll on doubles!
+				state = (die1 == die2 && !player.isDetained()) ? PRE_ROLL : DONE;
+				break;
+
+			default:
+				state = DONE;
+				break;
+
+		}
+	}
+	observer.notify(PhaseEvent{ PhaseEvent::BETWEEN_TURNS });
 
-void Simulator::populateChanceDeck() {
-	this->chance_deck_.push(*(new Card("Advance to Go",
-										CardActions::advanceToGo)));
-	this->chance_deck_.push(*(new Card("Advance to Illinois Ave.",
-										CardActions::advanceToIllinois)));
-	this->chance_deck_.push(*(new Card("Advance to St. Charles Place",
-										CardActions::advanceToStCharles)));
-	this->chance_deck_.push(*(new Card("Advance token to nearest Utility",
-										CardActions::advanceToNearestUtility)));
-	this->chance_deck_.push(*(new Card("Advance to nearest Railroad",
-										CardActions::advanceToNearestRailroad)));
-	this->chance_deck_.push(*(new Card("Bank pays you divident of $50")));
-	this->chance_deck_.push(*(new Card("Get Out of Jail Free")));
-	this->chance_deck_.push(*(new Card("Go back 3 spaces",
-										CardActions::retreatThreeSpaces)));
-	this->chance_deck_.push(*(new Card("Go to Jail",
-										CardActions::goToJail)));
-	this->chance_deck_.push(*(new Card("Make general repairs on all your property")));
-	this->chance_deck_.push(*(new Card("Pay poor tax of $15")));
-	this->chance_deck_.push(*(new Card("Take a ride on the Reading Railroad",
-										CardActions::advanceToReadingRailroad)));
-	this->chance_deck_.push(*(new Card("Advance token to Boardwalk",
-										CardActions::advanceToBoardwalk)));
-	this->chance_deck_.push(*(new Card("You have been elected Charirman of the Board")));
-	this->chance_deck_.push(*(new Card("Your building and loan matures")));
-	this->chance_deck_.push(*(new Card("You have won a crossword competition")));
 }
 
-void Simulator::populateCommunityChestDeck() {
-	this->community_chest_deck_.push(*(new Card("Advance to Go",
-												CardActions::advanceToGo)));
-	this->community_chest_deck_.push(*(new Card("Bank error in your favor")));
-	this->community_chest_deck_.push(*(new Card("Doctor's fees")));
-	this->community_chest_deck_.push(*(new Card("From sale of stock you get $50")));
-	this->community_chest_deck_.push(*(new Card("Get Out of Jail Free")));
-	this->community_chest_deck_.push(*(new Card("Go to Jail",
-												CardActions::goToJail)));
-	this->community_chest_deck_.push(*(new Card("Grand Opera opening")));
-	this->community_chest_deck_.push(*(new Card("Xmas fund matures")));
-	this->community_chest_deck_.push(*(new Card("Income tax refund")));
-	this->community_chest_deck_.push(*(new Card("It is your birthday")));
-	this->community_chest_deck_.push(*(new Card("Life insurance matures")));
-	this->community_chest_deck_.push(*(new Card("Pay hospital fees of $100")));
-	this->community_chest_deck_.push(*(new Card("Pay school fees of $150")));
-	this->community_chest_deck_.push(*(new Card("Receive for Services $25")));
-	this->community_chest_deck_.push(*(new Card("You are assessed for street repairs")));
-	this->community_chest_deck_.push(*(new Card("You have won second prize in a beauty contest")));
-	this->community_chest_deck_.push(*(new Card("You inherit $100")));
+/* Rolls a single die from the given Player's random stream */
+int Simulator::getDiceRoll(Player& player) {
+	return this->dice_[player.getId()].roll();
 }
 
 /**
- * Recursive move function. Simulates a Player's dice roll and responds
- * to the resulting roll, depending on the Player's current state. This
- * method is responsible for updating the Player's location, updating 'land'
- * counters for each Property on the Board, tracking the Player's 'jail'
- * state, and responding to events generated by properties and cards. This
- * method also manages the two card decks as well as each Player's hand. 
+ * Places a Player on the Property at a (valid) Board index and increments
+ * that Property's 'land' counter. Returns the Property's kind, which decides
+ * how the Property responds; names are only used for output.
  *
  * @param 	player 		A reference to a Player object
- * @param 	r_depth 	A recursive depth tracker used to trigger events
+ * @param 	index 		A Property index in the range [0, board size)
+ * @param 	observer 	The observer to report the landing to
  */
-void Simulator::simulateTurn(Player& player, int r_depth) {
-	
-	//Check whether the Player is in Jail and may use a Get Out of Jail Free card
-	if(player.isDetained()) {
-		if(player.hasGetOutOfJailChance) {
- 			//'Remove' the card from the Player's hand, and 'return' it to the deck
- 			player.hasGetOutOfJailChance = false;
- 			player.setDetention(false);
- 			this->chance_deck_.push(*(new Card("Get Out of Jail Free")));
- 			this->output_handle_ << "Player " << player.getId() << " uses his ";
- 			this->output_handle_ << "'Get Out of Jail Free' card to leave Jail.\n";
- 		} else
- 		if(player.hasGetOutOfJailCommunityChest) {
- 			//'Remove' the card from the Player's hand, and 'return' it to the deck
- 			player.hasGetOutOfJailCommunityChest = false;
- 			player.setDetention(false);
- 			this->community_chest_deck_.push(*(new Card("Get Out of Jail Free")));
-  			this->output_handle_ << "Player " << player.getId() << " uses his ";
- 			this->output_handle_ << "'Get Out of Jail Free' card to leave Jail.\n";
- 		}
-	}
-
-	//Simulate the Player's dice roll
-	int die1, die2;
-	bool doubles = ((die1 = this->getDiceRoll()) == (die2 = this->getDiceRoll()));
-	//Report the dice roll
-	this->output_handle_ << "Player " << player.getId() << " rolls " << die1 << "+" << die2 << "\n";
-
-	/**
-	 * Possible roll cases:
-	 *
-	 * 1. The player is not in jail, and rolls two different numbers - RETURN
-	 * 2. The player is not in jail, and rolls doubles - RECURSIVE
-	 *      - Must check that the Player didn't land in Jail after the first roll!
-	 * 3. The player is not in jail, and rolls doubles for the third time - RETURN
-	 * 4. The player is in jail, and rolls doubles - RECURSIVE
-	 * 5. The player is in jail, has been in jail for 3 turns - RETURN
-	 * 6. The player is in jail, and does not roll doubles - RETURN
-	 */
-	
-	 if(!player.isDetained()) {
-	 	/* Case 1 */
-	 	if(!doubles) {
-	 		this->advancePlayerBy(player, die1 + die2);
-	 		return;
-	 	} else
-	 	/* Case 2 */
-	 	if(doubles && r_depth < 2) {
-	 		this->advancePlayerBy(player, die1 * 2);
-	 		//We must check again for Player::isDetained; if they landed on
-	 		//'Go To Jail', then this value will have changed, and landing in Jail
-	 		//loses you your right to re-roll on doubles!
-	 		if(!player.isDetained()) {
-	 			return this->simulateTurn(player, r_depth + 1);
-	 		} else {
-				return;	 			
-	 		}
-	 	} else
-	 	/* Case 3 */
-	 	if(r_depth >= 2) {
-	 		//The Player has rolled 'doubles' three times in a row. As per Monopoly
-	 		//rules, they are sent to jail!
-	 		this->output_handle_ << "Player " << player.getId() << " has rolled 'doubles' three times!\n";
-	 		this->arrestPlayer(player);
-	 		return;
-	 	}
-	 } else {
-	 	/* Cases 4 */
-	 	if(doubles) {
-			//Let the Player advance according to their roll
-	 		this->releasePlayer(player);
-	 		this->advancePlayerBy(player, die1 + die2);
-	 		//We must check again for Player::isDetained; if they have landed on
-	 		//'Go To Jail', or have drawn a 'Go To Jail' card, then this value will
-	 		//have changed!
-	 		if(!player.isDetained()) {
-	 			return this->simulateTurn(player, r_depth + 1);
-	 		} else {
-	 			return;
-	 		}
-	 	} else
-	 	/* Case 5 */
-	 	if(player.getTurnsInJail() >= Player::MAXIMUM_JAIL_SENTENCE) {
-			//Let the Player advance according to their roll
-	 		this->releasePlayer(player);
-	 		this->advancePlayerBy(player, die1 + die2);
-	 		return;
-	 	} else {
-	 	/* Case 6 */
-	 		this->output_handle_ << " -> Player " << player.getId() << " spends another lonely night in Jail.\n";
-		 	player.incrementTurnsInJail();
-		 	return;
-	 	}
-	 }
+template<class Observer> Property::Kind Simulator::landOn(Player& player, int index, Observer& observer) {
+	Property& destination = this->board_.propertyAt(index);
+	//The Player's location is the destination's Board index
+	player.setLocation(index);
+	observer.notify(LandEvent{ (int)player.getId(), index, destination });
+	//Increase the destination Property's counter
+	destination.incrementCount();
+	return destination.kind();
+}
 
+/* Moves a Player to the Jail, updating that Player's state */
+template<class Observer> void Simulator::arrestPlayer(Player& player, ArrestEvent::Cause cause, Observer& observer) {
+	player.setLocation(this->board_.jailLocation());
+	this->board_.propertyAt(this->board_.jailLocation()).incrementCount();
+	player.setDetention(true);
+	observer.notify(ArrestEvent{ (int)player.getId(), cause });
 }
 
-int Simulator::getDiceRoll() { return (rand() % 6) + 1; }
+/* Releases the Player from Jail, updating the Player's state */
+template<class Observer> void Simulator::releasePlayer(Player& player, ReleaseEvent::Cause cause, Observer& observer) {
+	player.setDetention(false);
+	observer.notify(ReleaseEvent{ (int)player.getId(), cause });
+}
 
 /**
- * When a Player is to move to a specified Property on the Board, this
- * method updates the Player's location while incrementing the 'land'
- * counter for the respective Property.
+ * Draws the card at the front of a deck. A 'Get out of Jail Free' card goes to
+ * the Player's hand; any other card is out of the deck until the caller returns
+ * it. Returns the card's id.
  *
- * @param 	player 	A reference to a Player object
- * @param 	sum 	The total value of a dice roll
+ * @param 	deck 		The deck to draw from
+ * @param 	player 		A reference to the Player drawing the card
+ * @param 	observer 	The observer to report the draw to
  */
-void Simulator::advancePlayerBy(Player& player, int roll) {
-	//Determine the Player's destination
-	//We'll write it this way so that the location index still 'wraps'
-	Property& destination = this->board_.propertyAt(player.getLocation() + roll);
-	player.setLocation(this->board_.indexOf(destination));
-	//Report the Player's move
-	this->output_handle_ << "Player " << player.getId() << " landed on ";
-	this->output_handle_ << destination.name() << "\n";
-	//Increase the destination Property's counter
-	destination.incrementCount();
-	//Have the Property respond to the Player if necessary
-	if(destination.name() == "Go To Jail") {
-		this->arrestPlayer(player);
-	} else
-	if(destination.name() == "Chance") {
-		this->drawChance(player);
-	} else
-	if(destination.name() == "Community Chest") {
-		this->drawCommunityChest(player);
+template<class Observer> int Simulator::drawCard(CardDecks::Deck deck, Player& player, Observer& observer) {
+	//Once every card has been drawn since the last shuffle, shuffle again if asked to
+	if(this->config_.shufflePolicy() == CardDecks::SHUFFLE_WHEN_EXHAUSTED) {
+		if(this->undrawn_[deck] == 0) {
+			this->shuffleDeck(deck);
+		}
+		this->undrawn_[deck]--;
 	}
-}
-
-/* Draws a Chance card and follows its description */
-void Simulator::drawChance(Player& player) {
-	//Copy the card from the front of the Chance deck and remove
-	//the original from the deck
-	Card card = this->chance_deck_.front();
-	this->chance_deck_.pop();
-	//Report the resulting card
-	this->output_handle_ << " -> Chance - " << card.description() << "\n";
+	//Take the card id from the front of the deck
+	int id = this->decks_[deck].front();
+	this->decks_[deck].pop();
+	const Card& card = this->definition_->card(deck, id);
+	observer.notify(DrawEvent{ (int)player.getId(), deck, id, card });
 	//Determine whether this is a 'Get out of Jail Free' card
-	if(card.description() == "Get Out of Jail Free") {
+	if(card.effect() == Card::KEEP_CARD) {
 		//Set the appropriate flag for the Player
-		player.hasGetOutOfJailChance = true;
-	} else {
-		//Follow the action labeled on the card
-		card.performAction(*this, player);
-		//Return the card to the back of the deck
-		this->chance_deck_.push(card);
+		player.setGetOutOfJailCard(deck, true);
 	}
+	return id;
 }
 
-/* Draws a Community Chest card and follows its description */
-void Simulator::drawCommunityChest(Player& player) {
-	//Copy the card from the front of the Community Chest deck and
-	//remove the original from the deck
-	Card card = this->community_chest_deck_.front();
-	this->community_chest_deck_.pop();
-	//Report the resulting card
-	this->output_handle_ << "Player " << player.getId() << " drew a ";
-	this->output_handle_ << "'" << card.description() << "'\n";
-	//Determine whether this is a 'Get out of Jail Free' card
-	if(card.description() == "Get Out of Jail Free") {
-		//Set the appropriate flag for the Player
-		player.hasGetOutOfJailCommunityChest = true;
-	} else {
-		//Follow the action labeled on the card
-		card.performAction(*this, player);
-		//Return the card to the back of the deck
-		this->community_chest_deck_.push(card);
+/**
+ * Follows the effect printed on a drawn card (other than keeping it). Returns
+ * MOVED, with the destination set, if the card moves the Player; otherwise the
+ * Player is at rest and CARD_RESOLVED is returned.
+ *
+ * @param 	card 			The card being followed
+ * @param 	player 			A reference to a Player object
+ * @param 	destination 	Set to the Player's destination, if they move
+ * @param 	observer 		The observer to report an arrest to
+ */
+template<class Observer> Simulator::TurnState Simulator::followCard(const Card& card, Player& player, int& destination, Observer& observer) {
+	int location = player.getLocation();
+	switch(card.effect()) {
+		case Card::MOVE_TO:
+			destination = card.argument();
+			return MOVED;
+		case Card::MOVE_BY:
+			destination = this->board_.wrap(location + card.argument());
+			return MOVED;
+		case Card::MOVE_TO_NEAREST_RAILROAD:
+			destination = this->definition_->nearestRailroad(location);
+			return MOVED;
+		case Card::MOVE_TO_NEAREST_UTILITY:
+			destination = this->definition_->nearestUtility(location);
+			return MOVED;
+		case Card::GO_TO_JAIL:
+			this->arrestPlayer(player, ArrestEvent::GO_TO_JAIL_CARD, observer);
+			return CARD_RESOLVED;
+		default:
+			//No-op
+			return CARD_RESOLVED;
 	}
 }
 
-/* Releases the Player from Jail, updating the Player's state */
-void Simulator::releasePlayer(Player& player) {
-	//Release the player
-	player.setDetention(false);
-	//Report the release
-	this->output_handle_ << " -> Player " << player.getId() << " was released from Jail!\n";
+/**
+ * Called after every round when running until convergence. At the end of each
+ * batch of rounds following the burn-in, adds each Property's share of the
+ * batch's landings to the batch means. Returns whether every share's confidence
+ * interval is now within the configured half-width.
+ *
+ * @param 	rounds 	The number of rounds played so far
+ */
+bool Simulator::hasConverged(int rounds) {
+	int burn_in = this->config_.burnIn();
+	if(rounds < burn_in || (rounds - burn_in) % this->config_.batchSize() != 0) {
+		return false;
+	}
+	//Landings since the last boundary (or, at the end of the burn-in, during it)
+	double shares[Board::MAXIMUM_SIZE];
+	double total = 0;
+	for(int i = 0; i < this->board_.size(); i++) {
+		int count = this->board_.propertyAt(i).count();
+		shares[i] = count - this->batch_start_[i];
+		total += shares[i];
+		this->batch_start_[i] = count;
+	}
+	if(rounds == burn_in) {
+		//The burn-in's landings are discarded
+		return false;
+	}
+	for(int i = 0; i < this->board_.size(); i++) {
+		shares[i] /= total;
+	}
+	this->shares_.addBatch(shares);
+	return this->shares_.isWithin(this->config_.precision());
 }
 
-//Private helper methods
+/**
+ * Saves the complete state of the game: the settings (the board's fingerprint and
+ * the shuffle policy included) that a resumed run must share, the number of rounds played,
+ * the landing counts, every Player (and the position of their random stream) and
+ * the order of both decks (and the position of their shuffle streams).
+ *
+ * @param 	path 	The path of the checkpoint
+ */
+void Simulator::saveCheckpoint(const string& path) {
+	CheckpointWriter checkpoint(path);
+	checkpoint.put(this->config_.playerCount());
+	checkpoint.put((long long)this->seed_);
+	checkpoint.put(this->config_.firstGame());
+	checkpoint.put(this->board_.size());
+	checkpoint.put((long long)this->definition_->fingerprint());
+	checkpoint.put(this->config_.shufflePolicy());
+	checkpoint.put(this->rounds_played_);
+	for(int i = 0; i < this->board_.size(); i++) {
+		checkpoint.put(this->board_.propertyAt(i).count());
+	}
+	for(unsigned int p = 0; p < this->players_.size(); p++) {
+		Player& player = *(this->players_[p]);
+		checkpoint.put(player.getLocation());
+		checkpoint.put(player.isDetained());
+		checkpoint.put(player.getTurnsInJail());
+		checkpoint.put(player.hasGetOutOfJailCard(CardDecks::CHANCE_DECK));
+		checkpoint.put(player.hasGetOutOfJailCard(CardDecks::COMMUNITY_CHEST_DECK));
+		checkpoint.put((long long)this->dice_[p].blocksUsed());
+		checkpoint.put(this->dice_[p].rollsUsed());
+	}
+	for(int d = 0; d < CardDecks::DECK_COUNT; d++) {
+		checkpoint.put(this->decks_[d].size());
+		for(int c = 0; c < this->decks_[d].size(); c++) {
+			checkpoint.put(this->decks_[d].at(c));
+		}
+		checkpoint.put((long long)this->shuffles_[d].position());
+		checkpoint.put(this->undrawn_[d]);
+	}
+	checkpoint.commit();
+}
 
-/* Constructs a filepath string based on the current simulation */
-string Simulator::getOutputPath() const {
-	//Set up a dynamic filepath describing the simulation
-	ostringstream output_path;
-	output_path << this->config_.playerCount() << 'p';
-	output_path << this->config_.turnCount() << 'r';
-	if(this->config_.hasSeed()) { output_path << this->config_.seed() << 's'; }
-	else { output_path << 'Rand';}
-	if(this->config_.isVerbose()) { output_path << 'v'; }
-	//Return a string copy of the path
-	return string("output/" + output_path.str() + ".out");
-}	
-
-/* Outputs a boxed round label for a given round */
-void Simulator::printRoundLabel(int n) {
-	this->output_handle_ << "++++++++++++++++++++\n";
-	this->output_handle_ << "Starting round " << (n + 1) << "\n";
-	/*
-	this->output_handle_ << "|================================|\n";
-	this->output_handle_ << "|        Starting Round ";
-	this->output_handle_.width(9);
-	this->output_handle_ << left << n;
-	this->output_handle_ << "|\n";
-	this->output_handle_ << "|================================|\n\n";
-	*/
+/**
+ * Restores the state saved by saveCheckpoint() into a freshly set-up game.
+ * Throws an invalid_argument exception if the checkpoint belongs to a different
+ * game, or has already played past the configured turn count, and a runtime_error
+ * if the checkpoint is damaged.
+ *
+ * @param 	path 	The path of the checkpoint
+ */
+void Simulator::restoreCheckpoint(const string& path) {
+	CheckpointReader checkpoint(path);
+	if(checkpoint.get() != this->config_.playerCount()) {
+		throw invalid_argument("The checkpoint was saved with a different number of players!");
+	}
+	long long seed = checkpoint.get();
+	if(this->config_.hasSeed() && seed != this->config_.seed()) {
+		throw invalid_argument("The checkpoint was saved with a different seed!");
+	}
+	this->seed_ = seed;
+	if(checkpoint.get() != this->config_.firstGame()) {
+		throw invalid_argument("The checkpoint was saved from a different game!");
+	}
+	if(checkpoint.get() != this->board_.size() ||
+	   (unsigned long long)checkpoint.get() != this->definition_->fingerprint()) {
+		throw invalid_argument("The checkpoint was saved on a different board!");
+	}
+	if(checkpoint.get() != this->config_.shufflePolicy()) {
+		throw invalid_argument("The checkpoint was saved with a different shuffle policy!");
+	}
+	this->rounds_played_ = checkpoint.get(0, INT_MAX);
+	if(this->rounds_played_ > this->config_.turnCount()) {
+		throw invalid_argument("The checkpoint has already played more turns than requested!");
+	}
+	for(int i = 0; i < this->board_.size(); i++) {
+		this->board_.propertyAt(i).setCount(checkpoint.get(0, INT_MAX));
+	}
+	for(unsigned int p = 0; p < this->players_.size(); p++) {
+		Player& player = *(this->players_[p]);
+		player.setLocation(checkpoint.get(0, this->board_.size() - 1));
+		player.setDetention(checkpoint.get(0, 1) != 0);
+		for(int turns = checkpoint.get(0, Player::MAXIMUM_JAIL_SENTENCE); turns > 0; turns--) {
+			player.incrementTurnsInJail();
+		}
+		player.setGetOutOfJailCard(CardDecks::CHANCE_DECK, checkpoint.get(0, 1) != 0);
+		player.setGetOutOfJailCard(CardDecks::COMMUNITY_CHEST_DECK, checkpoint.get(0, 1) != 0);
+		//Rebuild the Player's stream from the saved seed, at the saved position
+		unsigned long long blocks = checkpoint.get(0, LLONG_MAX);
+		int rolls = checkpoint.get(0, DiceStream::BUFFER_SIZE);
+		this->dice_[p] = DiceStream(this->seed_, this->config_.firstGame(), p);
+		this->dice_[p].seek(blocks, rolls);
+	}
+	for(int d = 0; d < CardDecks::DECK_COUNT; d++) {
+		this->decks_[d].clear();
+		int size = this->definition_->deckSize((CardDecks::Deck)d);
+		for(int c = checkpoint.get(0, size); c > 0; c--) {
+			this->decks_[d].push(checkpoint.get(0, size - 1));
+		}
+		//Rebuild the deck's shuffle stream, at the saved position
+		this->shuffles_[d] = ShuffleStream(this->seed_, this->config_.firstGame(), d);
+		this->shuffles_[d].seek(checkpoint.get(0, LLONG_MAX));
+		this->undrawn_[d] = checkpoint.get(0, size);
+	}
 }
 
+//Private helper methods
+
 /* Outputs starting configuration/settings */
 void Simulator::printConfigSummary() {
-	this->allowOutput(true);
 	this->output_handle_ << "Num Players: " << this->config_.playerCount() << " ";
 	this->output_handle_ << "Turns: " << this->config_.turnCount() << "\n";
 	this->output_handle_ << "Verbose: " << this->config_.isVerbose() << "\n";
@@ -495,15 +601,28 @@ void Simulator::printConfigSummary() {
 
 /* Outputs 'landed on' statistics for all Properties on the Board */
 void Simulator::printPropertyStatistics() {
-	this->allowOutput(true);
 	this->output_handle_ << "\n";
 	/*
 	this->output_handle_ << "|================================|\n";
 	this->output_handle_ << "|       Property Statistics      |\n";
 	this->output_handle_ << "|================================|\n\n";
 	*/
-	for(unsigned int i = 0; i < Board::BOARD_SIZE; i++) {
-		Property p = this->board_.propertyAt(i);
+	if(this->config_.isConvergent()) {
+		//Each Property's share of the landings after the burn-in, with its 95% interval
+		this->output_handle_ << "Rounds: " << this->rounds_played_ << " ";
+		this->output_handle_ << "Batches: " << this->shares_.batchCount() << " ";
+		this->output_handle_ << "Converged: " << this->shares_.isWithin(this->config_.precision()) << "\n";
+		this->output_handle_.setf(ios::fixed);
+		this->output_handle_.precision(6);
+		for(int i = 0; i < this->board_.size(); i++) {
+			Property& p = this->board_.propertyAt(i);
+			this->output_handle_ << p.name() << " :: " << p.count() << " :: ";
+			this->output_handle_ << this->shares_.mean(i) << " +/- " << this->shares_.halfWidth(i) << "\n";
+		}
+		return;
+	}
+	for(int i = 0; i < this->board_.size(); i++) {
+		Property& p = this->board_.propertyAt(i);
 		/*
 		this->output_handle_.width(22);
 		this->output_handle_ << left << " " + p.name();
@@ -514,3 +633,16 @@ void Simulator::printPropertyStatistics() {
 	}
 }
 
+/*** Explicit instantiations ***/
+
+//The observers that runSimulation() may be called with
+template void Simulator::runSimulation<NullObserver>(NullObserver& observer);
+template void Simulator::runSimulation<TextObserver>(TextObserver& observer);
+template void Simulator::runSimulation<TraceWriter>(TraceWriter& observer);
+template void Simulator::runSimulation<StatsObserver>(StatsObserver& observer);
+template void Simulator::runSimulation<ObserverPair<TextObserver, StatsObserver> >(ObserverPair<TextObserver, StatsObserver>& observer);
+template void Simulator::runSimulation<ObserverPair<TraceWriter, StatsObserver> >(ObserverPair<TraceWriter, StatsObserver>& observer);
+
+//The steps that the benchmarks time on their own (see 'bench/SimulatorBench.h')
+template void Simulator::simulateTurn<NullObserver>(Player& player, NullObserver& observer);
+template int Simulator::drawCard<NullObserver>(CardDecks::Deck deck, Player& player, NullObserver& observer);
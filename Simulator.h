@@ -11,24 +11,60 @@
  * be landed on by players. This simplified version of Monopoly supports dice rolls,
  * roll rules (such as 'rolling doubles'), and 'Chance' and 'Community Chest' cards.
  * Players may also find themselves sent to the 'Jail' space, where they must wait
- * until they are released, as per the game's rules of play.
+ * until they are released, as per the game's rules of play. The Board and decks
+ * are built from the configured BoardDefinition (see 'BoardDefinition.h'); tiles
+ * respond by kind, and cards by effect, so any board is played the same way.
+ *
+ * Each event of a game (rolls, landings, card draws, arrests and releases) is
+ * reported to an observer that is given to runSimulation() as a template argument
+ * (see 'SimulatorEvents.h'). Verbose mode uses a TextObserver; otherwise the
+ * NullObserver is used, and no event is ever formatted. '--stats' adds a
+ * StatsObserver, which also hears when each turn enters a new phase (dice,
+ * movement, tile, cards or jail) and times the phases; every other observer
+ * ignores these PhaseEvents, so they cost nothing without it.
+ *
+ * With '--precision', the turn count is only an upper bound: after a burn-in, the
+ * landings of every batch of rounds are added to a BatchMeans, and the simulation
+ * stops as soon as every Property's share of the landings is known to within the
+ * configured half-width. The intervals are then reported with the statistics.
+ *
+ * Unless '--shuffle none' is given, the decks are shuffled before the game starts
+ * (and, with '--shuffle exhausted', whenever a deck has been drawn through), from
+ * the game's own deck streams (see 'Shuffle.h').
+ *
+ * With '--checkpoint', the complete state of the game (landing counts, Players,
+ * deck order and the position of every random stream) is saved every few rounds,
+ * and once more at the end. A run given '--resume' restores that state and plays
+ * on to its own turn count, so an interrupted or extended run writes exactly the
+ * same output as one that ran uninterrupted.
  */
 
 #ifndef SIMULATOR_H
 #define SIMULATOR_H
 
 //Protected includes (for arguments and return types)
-#include <fstream>
+#include <ostream>
 #include <string>
 #include <vector>
 #include "SimulatorConfig.h"
 #include "Board.h"
+#include "BoardDefinition.h"
 #include "Player.h"
-#include "lib/Queue.h"
+#include "lib/Arena.h"
+#include "lib/AsyncFileBuffer.h"
+#include "lib/BatchMeans.h"
+#include "lib/Ring.h"
 #include "Card.h"
+#include "CardDecks.h"
+#include "Dice.h"
+#include "Shuffle.h"
+#include "SimulatorEvents.h"
 
 class Simulator {
 
+	//The benchmarks time the turn logic directly (see 'bench/SimulatorBench.h')
+	friend class SimulatorBench;
+
 public:
 	
 	//Simulation class constructor
@@ -37,48 +73,67 @@ public:
 	~Simulator();
 
 	void runSimulation();
-
-	void advancePlayerTo(Player& player, int n);
-	void arrestPlayer(Player& player);
+	template<class Observer> void runSimulation(Observer& observer);
 
 private:
 
+	/* States of a Player's turn (see simulateTurn) */
+	enum TurnState { PRE_ROLL, JAIL, ROLLED, MOVED, CARD_RESOLVED, DONE };
+
 	/*** Private member variables ***/
 
 	//Configuration and output
-	SimulatorConfig &config_;
-	ofstream output_handle_;
+	SimulatorConfig config_;
+	AsyncFileBuffer output_buffer_;
+	ostream output_handle_;
 
 	//Internal simulation model
+	shared_ptr<const BoardDefinition> definition_;
 	Board board_;
+	Arena arena_;
 	vector<Player*> players_;
 
-	Queue<Card> chance_deck_;
-	Queue<Card> community_chest_deck_;
+	//Random number streams, one per Player
+	unsigned long long seed_;
+	vector<DiceStream> dice_;
 
-	/*** Private method implementation ***/
+	//Card decks, indexed by CardDecks::Deck; each deck is a ring of ids into the definition's deck
+	Ring<int, CardDecks::MAXIMUM_DECK_SIZE> decks_[CardDecks::DECK_COUNT];
+	//Each deck's shuffles, and the draws left before it is shuffled again (see shufflePolicy())
+	ShuffleStream shuffles_[CardDecks::DECK_COUNT];
+	int undrawn_[CardDecks::DECK_COUNT];
+
+	//Convergence: rounds played, landing counts at the last batch boundary, and
+	//the batches' shares of the landings
+	int rounds_played_;
+	int batch_start_[Board::MAXIMUM_SIZE];
+	BatchMeans shares_;
 
-	void allowOutput(bool allow);
-	void clearOutput();
+	/*** Private method implementation ***/
 
+	void closeOutput();
 	void populateBoard();
-	void populateChanceDeck();
-	void populateCommunityChestDeck();
+	void populateDecks();
+	void shuffleDeck(CardDecks::Deck deck);
 
-	void simulateTurn(Player& player, int r_depth = 0);
-	int getDiceRoll();
+	//Turn logic; each event of the turn is reported to an observer
+	template<class Observer> void simulateTurn(Player& player, Observer& observer);
+	int getDiceRoll(Player& player);
 
-	void advancePlayerBy(Player& player, int roll);
+	template<class Observer> Property::Kind landOn(Player& player, int index, Observer& observer);
+	template<class Observer> void arrestPlayer(Player& player, ArrestEvent::Cause cause, Observer& observer);
+	template<class Observer> void releasePlayer(Player& player, ReleaseEvent::Cause cause, Observer& observer);
 	
-	void drawChance(Player& player);
-	void drawCommunityChest(Player& player);
-	void releasePlayer(Player& player);
+	template<class Observer> int drawCard(CardDecks::Deck deck, Player& player, Observer& observer);
+	template<class Observer> TurnState followCard(const Card& card, Player& player, int& destination, Observer& observer);
+
+	bool hasConverged(int rounds);
+
+	void saveCheckpoint(const string& path);
+	void restoreCheckpoint(const string& path);
 
 	//Helper methods
 
-	string getOutputPath() const;	
-	
-	void printRoundLabel(int n);
 	void printConfigSummary();
 	void printPropertyStatistics();
 
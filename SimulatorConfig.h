@@ -12,6 +12,44 @@
  * 		2. The number of turns allowed for each player 	[REQUIRED]
  *  	3. The initial random seed  					[OPTIONAL]
  *  	4. Flag for 'verbose mode' 						[OPTIONAL]
+ *
+ * The positional arguments may be followed by named options:
+ *
+ * 		--games N 	Simulate N independent games in lockstep (batch mode)
+ * 		--game K 	Start from game K of the seed's sequence of games (default 0)
+ * 		--threads T Spread batch games across T worker threads (default: all cores)
+ * 		--trace 	Record a verbose run's events in a binary trace (see 'Trace.h')
+ * 		--markov 	Compute a lone Player's exact long-run landing probabilities
+ * 					instead of playing games; needs 1 player and '--shuffle none'
+ * 					(see 'MarkovSolver.h')
+ * 		--precision H 	Stop once every Property's share of the landings is known
+ * 					to within +/- H (95% confidence); the turn count becomes an
+ * 					upper bound (see 'lib/BatchMeans.h')
+ * 		--burn-in R Rounds played before landings are observed (default 1000)
+ * 		--batch R 	Rounds in each batch of observed landings (default 1000)
+ * 		--checkpoint R 	Save the complete simulation state every R rounds (see
+ * 					'Checkpoint.h')
+ * 		--resume PATH 	Continue the run saved in a checkpoint, up to the (possibly
+ * 					larger) turn count given
+ * 		--stats 	Count the run's events and time the phases of its turns, and
+ * 					print them when it ends (see 'StatsObserver.h')
+ * 		--sweep-players LIST 	Run every combination of the listed player counts,
+ * 		--sweep-turns LIST 		turn counts and seeds in one process, and write
+ * 		--sweep-seeds LIST 		one table of results (see 'SweepRunner.h'); an
+ * 					axis that is not listed takes the positional argument's value
+ * 		--sweep-boards PATHS 	Also sweep over a comma-separated list of board
+ * 					definition files ('classic' for the classic board), or
+ * 		--sweep-shuffle WHENS 	of shuffle policies; an axis that is not
+ * 					listed takes the '--board' or '--shuffle' option's value
+ * 		--board PATH 	Play on the board described in a definition file, such as
+ * 					'boards/uk.board', instead of the classic board (see
+ * 					'BoardDefinition.h')
+ * 		--shuffle WHEN 	Shuffle each game's decks at the 'start' of the game (the
+ * 					default), also whenever a deck is 'exhausted', or 'none' to
+ * 					draw them in their printed order (see 'CardDecks.h')
+ *
+ * A LIST is a comma-separated list of values and ranges, where a range is written
+ * 'first:last' or 'first:last:step' (e.g. '2,4:6' or '1000:5000:1000').
  */
 
 #ifndef SIMULATOR_CONFIG_H
@@ -19,16 +57,26 @@
 
 //Protected includes
 #include <cstdlib>
+#include <ctime>
 #include <stdexcept>
 #include <string>
+#include <sstream>
+#include <vector>
+#include <memory>
 //#include "unistd.h"
+#include "BoardDefinition.h"
+#include "CardDecks.h"
 
 using namespace std;
 
 class SimulatorConfig {
-	
+
 public:
 
+	//Rounds of burn-in, and rounds per batch, when running until convergence
+	static const int DEFAULT_BURN_IN = 1000;
+	static const int DEFAULT_BATCH_SIZE = 1000;
+
 	/**
 	 * SimulatorConfig constructor. Accepts command-line argument information
 	 * provided by the user of the class.
@@ -36,35 +84,214 @@ public:
 	 * @param 	argc 	The number of arguments passed to the program
 	 * @param 	argv 	A pointer to an array of character pointers (strings)
 	 */
-	SimulatorConfig(int argc, char *argv[]) : has_seed_(false) {
-		if(argc < 3 || argc > 5) {
+	SimulatorConfig(int argc, char *argv[])
+	: has_seed_(false), seed_((int)time(NULL)), verbose_(false), game_count_(1), first_game_(0), thread_count_(0), trace_(false), markov_(false),
+	  precision_(0), burn_in_(DEFAULT_BURN_IN), batch_size_(DEFAULT_BATCH_SIZE), checkpoint_interval_(0), stats_(false),
+	  board_(BoardDefinition::classic()), shuffle_(CardDecks::SHUFFLE_AT_START) {
+		if(argc < 3) {
 			throw invalid_argument("Invalid number of command-line arguments!");
 		} else {
 			int pc = atoi(argv[1]);
-			if(pc < 2 || pc > 6) {
+			//A lone Player is only allowed for the Markov solver (see below)
+			if(pc < 1 || pc > 6) {
 				throw invalid_argument("Invalid number of players. Only 2—6 players may play!");
 			}
 			this->player_count_ = atoi(argv[1]);
 			this->turn_count_ = atoi(argv[2]);
-			if(argc > 3) {
+			int i = 3;
+			if(argc > 3 && string(argv[3]).compare(0, 2, "--") != 0) {
 				//Was a seed specified
 				this->has_seed_ = true;
 				this->seed_ = atoi(argv[3]);
-				if(argc > 4) {
+				i++;
+				if(argc > 4 && string(argv[4]).compare(0, 2, "--") != 0) {
 					//Was 'verbose' mode specified?
 					string flag = argv[4];
 					this->verbose_ = (flag == "-v") ? true : false;
+					i++;
+				}
+			}
+			//Named options
+			for(; i < argc; i++) {
+				string option = argv[i];
+				if(option == "--games" && i + 1 < argc) {
+					this->game_count_ = atoi(argv[++i]);
+					if(this->game_count_ < 1) {
+						throw invalid_argument("Invalid number of games. At least 1 game must be played!");
+					}
+				} else
+				if(option == "--game" && i + 1 < argc) {
+					this->first_game_ = atoi(argv[++i]);
+					if(this->first_game_ < 0) {
+						throw invalid_argument("Invalid game index. Games are numbered from 0!");
+					}
+				} else
+				if(option == "--threads" && i + 1 < argc) {
+					this->thread_count_ = atoi(argv[++i]);
+					if(this->thread_count_ < 1) {
+						throw invalid_argument("Invalid number of threads. At least 1 thread must run!");
+					}
+				} else
+				if(option == "--trace") {
+					this->trace_ = true;
+				} else
+				if(option == "--markov") {
+					this->markov_ = true;
+				} else
+				if(option == "--precision" && i + 1 < argc) {
+					this->precision_ = atof(argv[++i]);
+					if(!(this->precision_ > 0)) {
+						throw invalid_argument("Invalid precision. The intervals' half-width must be positive!");
+					}
+				} else
+				if(option == "--burn-in" && i + 1 < argc) {
+					this->burn_in_ = atoi(argv[++i]);
+					if(this->burn_in_ < 0) {
+						throw invalid_argument("Invalid burn-in. The number of rounds may not be negative!");
+					}
+				} else
+				if(option == "--batch" && i + 1 < argc) {
+					this->batch_size_ = atoi(argv[++i]);
+					if(this->batch_size_ < 1) {
+						throw invalid_argument("Invalid batch size. Each batch must hold at least 1 round!");
+					}
+				} else
+				if(option == "--checkpoint" && i + 1 < argc) {
+					this->checkpoint_interval_ = atoi(argv[++i]);
+					if(this->checkpoint_interval_ < 1) {
+						throw invalid_argument("Invalid checkpoint interval. Checkpoints must be at least 1 round apart!");
+					}
+				} else
+				if(option == "--resume" && i + 1 < argc) {
+					this->resume_path_ = argv[++i];
+				} else
+				if(option == "--stats") {
+					this->stats_ = true;
+				} else
+				if(option == "--sweep-players" && i + 1 < argc) {
+					this->sweep_players_ = SimulatorConfig::parseList(argv[++i]);
+					for(unsigned int v = 0; v < this->sweep_players_.size(); v++) {
+						if(this->sweep_players_[v] < 2 || this->sweep_players_[v] > 6) {
+							throw invalid_argument("Invalid number of players. Only 2—6 players may play!");
+						}
+					}
+				} else
+				if(option == "--sweep-turns" && i + 1 < argc) {
+					this->sweep_turns_ = SimulatorConfig::parseList(argv[++i]);
+					for(unsigned int v = 0; v < this->sweep_turns_.size(); v++) {
+						if(this->sweep_turns_[v] < 0) {
+							throw invalid_argument("Invalid number of turns. The number of turns may not be negative!");
+						}
+					}
+				} else
+				if(option == "--sweep-seeds" && i + 1 < argc) {
+					this->sweep_seeds_ = SimulatorConfig::parseList(argv[++i]);
+				} else
+				if(option == "--sweep-boards" && i + 1 < argc) {
+					this->sweep_boards_ = SimulatorConfig::parseNames(argv[++i]);
+					this->sweep_definitions_.clear();
+					for(unsigned int v = 0; v < this->sweep_boards_.size(); v++) {
+						if(this->sweep_boards_[v] == "classic") {
+							this->sweep_boards_[v] = "";
+							this->sweep_definitions_.push_back(BoardDefinition::classic());
+						} else {
+							this->sweep_definitions_.push_back(BoardDefinition::load(this->sweep_boards_[v]));
+						}
+					}
+				} else
+				if(option == "--sweep-shuffle" && i + 1 < argc) {
+					vector<string> policies = SimulatorConfig::parseNames(argv[++i]);
+					this->sweep_shuffles_.clear();
+					for(unsigned int v = 0; v < policies.size(); v++) {
+						this->sweep_shuffles_.push_back(SimulatorConfig::parseShuffle(policies[v]));
+					}
+				} else
+				if(option == "--board" && i + 1 < argc) {
+					this->board_path_ = argv[++i];
+					this->board_ = BoardDefinition::load(this->board_path_);
+				} else
+				if(option == "--shuffle" && i + 1 < argc) {
+					this->shuffle_ = SimulatorConfig::parseShuffle(argv[++i]);
+				} else {
+					throw invalid_argument("Unrecognized command-line option: " + option);
 				}
 			}
+			if(this->trace_ && !this->verbose_) {
+				throw invalid_argument("Only verbose runs may be traced!");
+			}
+			if(this->markov_ && (this->verbose_ || this->game_count_ > 1)) {
+				throw invalid_argument("The Markov solver plays no games, so it can't be verbose or batched!");
+			}
+			if(this->markov_ && (this->player_count_ != 1 || this->shuffle_ != CardDecks::UNSHUFFLED)) {
+				throw invalid_argument("The Markov solver is only exact for a lone Player drawing from unshuffled decks (1 player, '--shuffle none')!");
+			}
+			if(!this->markov_ && this->player_count_ < 2) {
+				throw invalid_argument("Invalid number of players. Only 2—6 players may play!");
+			}
+			if(this->isConvergent() && (this->markov_ || this->game_count_ > 1 || this->trace_)) {
+				throw invalid_argument("Only a single, untraced game may run until its estimates converge!");
+			}
+			if((this->isCheckpointed() || this->isResumed()) &&
+			   (this->verbose_ || this->markov_ || this->game_count_ > 1 || this->isConvergent())) {
+				throw invalid_argument("Only a single, non-verbose game with a fixed turn count may be checkpointed!");
+			}
+			if(this->stats_ && (this->markov_ || this->game_count_ > 1)) {
+				throw invalid_argument("Only a single game's events may be counted!");
+			}
+			if(this->isSwept() && (this->verbose_ || this->markov_ || this->isConvergent() ||
+			   this->isCheckpointed() || this->isResumed() || this->stats_)) {
+				throw invalid_argument("A sweep only plays fixed-length, non-verbose games!");
+			}
+		}
+	}
+
+	/**
+	 * SimulatorConfig constructor. Describes a plain, non-verbose run without any
+	 * command-line arguments (e.g. for the library interface in 'monopoly.h').
+	 * Throws an invalid_argument exception for the same values that the
+	 * command line rejects.
+	 *
+	 * @param 	player_count 	The number of players in each game
+	 * @param 	turn_count 		The number of turns allowed for each player
+	 * @param 	has_seed 		Whether a seed is given (otherwise the time is used)
+	 * @param 	seed 			The initial random seed
+	 * @param 	game_count 		The number of games to simulate
+	 * @param 	first_game 		The index of the first game in the seed's sequence
+	 * @param 	thread_count 	The number of worker threads, or 0 to use every core
+	 * @param 	board_path 		A board definition file, or "" for the classic board
+	 */
+	SimulatorConfig(int player_count, int turn_count, bool has_seed, int seed,
+					int game_count = 1, int first_game = 0, int thread_count = 0, const string& board_path = "")
+	: player_count_(player_count), turn_count_(turn_count), has_seed_(has_seed), seed_(has_seed ? seed : (int)time(NULL)),
+	  verbose_(false), game_count_(game_count), first_game_(first_game), thread_count_(thread_count), trace_(false), markov_(false),
+	  precision_(0), burn_in_(DEFAULT_BURN_IN), batch_size_(DEFAULT_BATCH_SIZE), checkpoint_interval_(0), stats_(false),
+	  board_path_(board_path), board_(BoardDefinition::classic()), shuffle_(CardDecks::SHUFFLE_AT_START) {
+		if(player_count < 2 || player_count > 6) {
+			throw invalid_argument("Invalid number of players. Only 2—6 players may play!");
+		}
+		if(turn_count < 0) {
+			throw invalid_argument("Invalid number of turns. The number of turns may not be negative!");
+		}
+		if(game_count < 1) {
+			throw invalid_argument("Invalid number of games. At least 1 game must be played!");
+		}
+		if(first_game < 0) {
+			throw invalid_argument("Invalid game index. Games are numbered from 0!");
+		}
+		if(thread_count < 0) {
+			throw invalid_argument("Invalid number of threads. At least 1 thread must run!");
+		}
+		if(!board_path.empty()) {
+			this->board_ = BoardDefinition::load(board_path);
 		}
 	}
 
 	/* Accessors methods */
 
 	int playerCount() const { return this->player_count_; }
-	
+
 	int turnCount() const { return this->turn_count_; }
-	
+
 	bool hasSeed() const { return this->has_seed_; }
 	int seed() const {
 		if(!this->has_seed_) {
@@ -72,9 +299,153 @@ public:
 		}
 		return this->seed_;
 	}
-	
+	/* Returns the seed, or the time of construction if none was provided */
+	int resolvedSeed() const { return this->seed_; }
+
 	bool isVerbose() const { return this->verbose_; }
 
+	int gameCount() const { return this->game_count_; }
+
+	int firstGame() const { return this->first_game_; }
+
+	/* Returns the number of worker threads, or 0 to use every core */
+	int threadCount() const { return this->thread_count_; }
+
+	/* Returns whether events are recorded in a binary trace rather than as text */
+	bool isTraced() const { return this->trace_; }
+
+	/* Returns whether the landing probabilities are solved for rather than sampled */
+	bool isMarkov() const { return this->markov_; }
+
+	/* Returns whether the run stops once its estimates reach the configured precision */
+	bool isConvergent() const { return this->precision_ > 0; }
+
+	/* Returns the target half-width of the landing shares' confidence intervals */
+	double precision() const { return this->precision_; }
+
+	int burnIn() const { return this->burn_in_; }
+
+	int batchSize() const { return this->batch_size_; }
+
+	/* Returns whether the simulation state is saved periodically */
+	bool isCheckpointed() const { return this->checkpoint_interval_ > 0; }
+
+	/* Returns the number of rounds between checkpoints */
+	int checkpointInterval() const { return this->checkpoint_interval_; }
+
+	/* Returns whether the run continues from a checkpoint */
+	bool isResumed() const { return !this->resume_path_.empty(); }
+
+	/* Returns the path of the checkpoint that the run continues from */
+	const string& resumePath() const { return this->resume_path_; }
+
+	/* Returns whether the run's events are counted and its turn phases timed */
+	bool hasStats() const { return this->stats_; }
+
+	/* Returns whether the game is played on a board read from a definition file */
+	bool hasCustomBoard() const { return !this->board_path_.empty(); }
+
+	/* Returns the path of the board's definition file ("" for the classic board) */
+	const string& boardPath() const { return this->board_path_; }
+
+	/* Returns the definition of the board that the game is played on */
+	shared_ptr<const BoardDefinition> board() const { return this->board_; }
+
+	/* Returns when each game's decks are shuffled */
+	CardDecks::Shuffle shufflePolicy() const { return this->shuffle_; }
+
+	/* Returns whether the run sweeps over a grid of boards, shuffle policies, player
+	 * counts, turn counts and seeds
+	 */
+	bool isSwept() const {
+		return !this->sweep_players_.empty() || !this->sweep_turns_.empty() || !this->sweep_seeds_.empty() ||
+			   !this->sweep_boards_.empty() || !this->sweep_shuffles_.empty();
+	}
+
+	/* Returns the definitions of the boards swept over (the configured board, if none were listed) */
+	vector<shared_ptr<const BoardDefinition>> sweepBoards() const {
+		return this->sweep_definitions_.empty() ? vector<shared_ptr<const BoardDefinition>>(1, this->board_) : this->sweep_definitions_;
+	}
+
+	/* Returns the shuffle policies swept over (the configured policy, if none were listed) */
+	vector<CardDecks::Shuffle> sweepShuffles() const {
+		return this->sweep_shuffles_.empty() ? vector<CardDecks::Shuffle>(1, this->shuffle_) : this->sweep_shuffles_;
+	}
+
+	/* Returns the player counts swept over (the configured count, if none were listed) */
+	vector<int> sweepPlayers() const {
+		return this->sweep_players_.empty() ? vector<int>(1, this->player_count_) : this->sweep_players_;
+	}
+
+	/* Returns the turn counts swept over (the configured count, if none were listed) */
+	vector<int> sweepTurns() const {
+		return this->sweep_turns_.empty() ? vector<int>(1, this->turn_count_) : this->sweep_turns_;
+	}
+
+	/* Returns the seeds swept over (the resolved seed, if none were listed) */
+	vector<int> sweepSeeds() const {
+		return this->sweep_seeds_.empty() ? vector<int>(1, this->seed_) : this->sweep_seeds_;
+	}
+
+	/**
+	 * Returns a copy of this config describing a single point of its sweep: the
+	 * same options, with the given player count, turn count and seed, and no sweep.
+	 *
+	 * @param 	player_count 	The point's number of players
+	 * @param 	turn_count 		The point's number of turns
+	 * @param 	seed 			The point's seed
+	 */
+	SimulatorConfig atPoint(int player_count, int turn_count, int seed) const {
+		SimulatorConfig point(*this);
+		point.player_count_ = player_count;
+		point.turn_count_ = turn_count;
+		point.has_seed_ = true;
+		point.seed_ = seed;
+		point.sweep_players_.clear();
+		point.sweep_turns_.clear();
+		point.sweep_seeds_.clear();
+		point.sweep_boards_.clear();
+		point.sweep_definitions_.clear();
+		point.sweep_shuffles_.clear();
+		return point;
+	}
+
+	/**
+	 * Returns a copy of this config played on one board of its sweep with the given
+	 * shuffle policy: the same options, sweeping over the same player counts, turn
+	 * counts and seeds, but over no other board or shuffle policy.
+	 *
+	 * @param 	board 		The board's index in sweepBoards()
+	 * @param 	shuffle 	The shuffle policy
+	 */
+	SimulatorConfig onBoard(int board, CardDecks::Shuffle shuffle) const {
+		SimulatorConfig setting(*this);
+		if(!this->sweep_definitions_.empty()) {
+			setting.board_path_ = this->sweep_boards_[board];
+			setting.board_ = this->sweep_definitions_[board];
+		}
+		setting.shuffle_ = shuffle;
+		setting.sweep_boards_.clear();
+		setting.sweep_definitions_.clear();
+		setting.sweep_shuffles_.clear();
+		return setting;
+	}
+
+	/* Constructs a filepath string describing the configured simulation */
+	string outputPath() const {
+		return this->outputStem() + ".out";
+	}
+
+	/* Constructs the filepath of the configured simulation's binary trace */
+	string tracePath() const {
+		return this->outputStem() + ".trace";
+	}
+
+	/* Constructs the filepath of the configured simulation's checkpoint */
+	string checkpointPath() const {
+		return this->outputStem() + ".ckpt";
+	}
+
 private:
 
 	int player_count_;
@@ -82,7 +453,131 @@ private:
 	bool has_seed_;
 	int seed_;
 	bool verbose_;
+	int game_count_;
+	int first_game_;
+	int thread_count_;
+	bool trace_;
+	bool markov_;
+	double precision_;
+	int burn_in_;
+	int batch_size_;
+	int checkpoint_interval_;
+	string resume_path_;
+	bool stats_;
+	vector<int> sweep_players_;
+	vector<int> sweep_turns_;
+	vector<int> sweep_seeds_;
+	vector<string> sweep_boards_;
+	vector<shared_ptr<const BoardDefinition>> sweep_definitions_;
+	vector<CardDecks::Shuffle> sweep_shuffles_;
+	string board_path_;
+	shared_ptr<const BoardDefinition> board_;
+	CardDecks::Shuffle shuffle_;
+
+	/* Constructs the filepath, less extension, of the simulation's output */
+	string outputStem() const {
+		ostringstream output_path;
+		output_path << this->player_count_ << 'p';
+		output_path << this->turn_count_ << 'r';
+		if(this->has_seed_) { output_path << this->seed_ << 's'; }
+		else { output_path << "Rand"; }
+		if(this->game_count_ > 1) { output_path << this->game_count_ << 'g'; }
+		if(this->first_game_ > 0) { output_path << this->first_game_ << 'f'; }
+		if(this->verbose_) { output_path << 'v'; }
+		if(this->markov_) { output_path << 'm'; }
+		if(this->isConvergent()) { output_path << 'c'; }
+		if(this->isSwept()) { output_path << 'w'; }
+		if(this->shuffle_ == CardDecks::UNSHUFFLED) { output_path << 'u'; }
+		if(this->shuffle_ == CardDecks::SHUFFLE_WHEN_EXHAUSTED) { output_path << 'e'; }
+		if(this->hasCustomBoard()) {
+			//Named after the definition file, less its directory and extension
+			string stem = this->board_path_.substr(this->board_path_.find_last_of('/') + 1);
+			output_path << '-' << stem.substr(0, stem.find('.'));
+		}
+		//Return a string copy of the path
+		return string("output/" + output_path.str());
+	}
+
+	/**
+	 * Parses a comma-separated list of values and 'first:last[:step]' ranges.
+	 * Throws an invalid_argument exception if the list is malformed or empty.
+	 *
+	 * @param 	list 	The list, as given on the command line
+	 */
+	static vector<int> parseList(const string& list) {
+		vector<int> values;
+		istringstream items(list);
+		string item;
+		while(getline(items, item, ',')) {
+			istringstream fields(item);
+			int first, last, step = 1;
+			char separator;
+			if(!(fields >> first)) {
+				throw invalid_argument("Invalid list: " + list);
+			}
+			last = first;
+			if(fields >> separator) {
+				if(separator != ':' || !(fields >> last)) {
+					throw invalid_argument("Invalid list: " + list);
+				}
+				if(fields >> separator && (separator != ':' || !(fields >> step) || step < 1)) {
+					throw invalid_argument("Invalid list: " + list);
+				}
+			}
+			if(!fields.eof() || last < first) {
+				throw invalid_argument("Invalid list: " + list);
+			}
+			for(long long v = first; v <= last; v += step) {
+				values.push_back((int)v);
+			}
+		}
+		if(values.empty()) {
+			throw invalid_argument("Invalid list: " + list);
+		}
+		return values;
+	}
+
+	/**
+	 * Parses a comma-separated list of names (e.g. paths or shuffle policies).
+	 * Throws an invalid_argument exception if any name is empty.
+	 *
+	 * @param 	list 	The list, as given on the command line
+	 */
+	static vector<string> parseNames(const string& list) {
+		vector<string> names;
+		istringstream items(list);
+		string item;
+		while(getline(items, item, ',')) {
+			if(item.empty()) {
+				throw invalid_argument("Invalid list: " + list);
+			}
+			names.push_back(item);
+		}
+		if(names.empty() || list[list.size() - 1] == ',') {
+			throw invalid_argument("Invalid list: " + list);
+		}
+		return names;
+	}
+
+	/**
+	 * Parses a shuffle policy's name, as given to '--shuffle'. Throws an
+	 * invalid_argument exception for an unknown policy.
+	 *
+	 * @param 	policy 	The policy's name
+	 */
+	static CardDecks::Shuffle parseShuffle(const string& policy) {
+		if(policy == "none") {
+			return CardDecks::UNSHUFFLED;
+		}
+		if(policy == "start") {
+			return CardDecks::SHUFFLE_AT_START;
+		}
+		if(policy == "exhausted") {
+			return CardDecks::SHUFFLE_WHEN_EXHAUSTED;
+		}
+		throw invalid_argument("Invalid shuffle policy. Decks are shuffled at the 'start', when 'exhausted', or 'none'!");
+	}
 
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,123 @@
+/**
+ * @file SimulatorEvents.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Describes the events that the Simulator reports while it plays a game. Rather
+ * than writing text as it goes, the Simulator hands a typed event to an observer
+ * at each step of a turn. The observer is a template parameter of the Simulator's
+ * turn logic, so every call is resolved at compile time: an observer need only
+ * provide a notify() overload for each event type, and the NullObserver's empty
+ * overloads compile away completely.
+ *
+ * Besides the events of the game itself, the turn logic reports a PhaseEvent each
+ * time it moves on to a different kind of work, for observers that time the phases
+ * of a turn; every other observer ignores it.
+ *
+ * See 'TextObserver.h' for the observer behind verbose mode, and 'StatsObserver.h'
+ * for the one behind '--stats'.
+ */
+
+#ifndef SIMULATOR_EVENTS_H
+#define SIMULATOR_EVENTS_H
+
+//Protected includes
+#include "Property.h"
+#include "Card.h"
+#include "CardDecks.h"
+
+/* A new round of turns begins */
+struct RoundEvent {
+	int round;
+};
+
+/* A Player begins their turn on the given Property */
+struct TurnEvent {
+	int player;
+	const Property& property;
+};
+
+/* A Player rolls the dice */
+struct RollEvent {
+	int player;
+	int die1;
+	int die2;
+};
+
+/* A Player lands on (and is counted on) the Property at the given index */
+struct LandEvent {
+	int player;
+	int index;
+	const Property& property;
+};
+
+/* A Player draws a card (identified by its position in the board's deck) from one of the decks */
+struct DrawEvent {
+	int player;
+	CardDecks::Deck deck;
+	int id;
+	const Card& card;
+};
+
+/* A Player is sent to Jail */
+struct ArrestEvent {
+	enum Cause { GO_TO_JAIL_PROPERTY, GO_TO_JAIL_CARD, THIRD_DOUBLES };
+	int player;
+	Cause cause;
+};
+
+/* A Player leaves Jail */
+struct ReleaseEvent {
+	enum Cause { DOUBLES, SENTENCE_SERVED, GET_OUT_OF_JAIL_FREE };
+	int player;
+	Cause cause;
+};
+
+/* A Player fails to leave Jail, and stays another turn */
+struct StayEvent {
+	int player;
+};
+
+/* The turn logic moves on to a different phase of a turn */
+struct PhaseEvent {
+	enum Phase { BETWEEN_TURNS, DICE, MOVEMENT, TILE, CARDS, JAIL, PHASE_COUNT };
+	Phase phase;
+};
+
+/* Ignores every event; the default observer for non-verbose runs */
+class NullObserver {
+
+public:
+
+	void notify(const RoundEvent&) { }
+	void notify(const TurnEvent&) { }
+	void notify(const RollEvent&) { }
+	void notify(const LandEvent&) { }
+	void notify(const DrawEvent&) { }
+	void notify(const ArrestEvent&) { }
+	void notify(const ReleaseEvent&) { }
+	void notify(const StayEvent&) { }
+	void notify(const PhaseEvent&) { }
+
+};
+
+/* Hands every event to two observers, in order */
+template<class First, class Second> class ObserverPair {
+
+public:
+
+	ObserverPair(First& first, Second& second) : first_(first), second_(second) { }
+
+	template<class Event> void notify(const Event& event) {
+		this->first_.notify(event);
+		this->second_.notify(event);
+	}
+
+private:
+
+	First& first_;
+	Second& second_;
+
+};
+
+#endif
@@ -0,0 +1,205 @@
+/**
+ * @file StatsObserver.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Describes and implements the StatsObserver class, which counts what happens
+ * during a run and times the phases of every turn. It is the observer behind the
+ * '--stats' option; runs without it use an observer that ignores these events, so
+ * neither the counters nor the timers cost anything unless they were asked for.
+ *
+ * The counters follow the game's events: rolls and doubles, how many doubles each
+ * turn rolled, landings, card draws by deck, arrests and releases by cause, and
+ * stays in Jail. The timers follow the PhaseEvents: the time between two of them
+ * is charged to the phase that the first one started. Time is read from the CPU's
+ * time-stamp counter where there is one (x86), and from the steady clock, in
+ * nanoseconds, elsewhere.
+ */
+
+#ifndef STATS_OBSERVER_H
+#define STATS_OBSERVER_H
+
+//Protected includes
+#include <chrono>
+#include <iomanip>
+#include <ostream>
+#include "SimulatorEvents.h"
+#include "CardDecks.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+using namespace std;
+
+class StatsObserver {
+
+public:
+
+	//The most doubles that a turn can roll (the third one ends it)
+	static const int MAXIMUM_DOUBLES = 3;
+
+	/* StatsObserver class constructor. Every counter starts at zero. */
+	StatsObserver()
+	: rounds_(0), turns_(0), rolls_(0), doubles_(0), landings_(0), stays_(0),
+	  turn_doubles_(0), phase_(PhaseEvent::BETWEEN_TURNS), last_tick_(StatsObserver::tick()) {
+		for(int d = 0; d <= MAXIMUM_DOUBLES; d++) {
+			this->turns_by_doubles_[d] = 0;
+		}
+		for(int d = 0; d < CardDecks::DECK_COUNT; d++) {
+			this->draws_[d] = 0;
+		}
+		for(int c = 0; c < CAUSE_COUNT; c++) {
+			this->arrests_[c] = 0;
+			this->releases_[c] = 0;
+		}
+		for(int p = 0; p < PhaseEvent::PHASE_COUNT; p++) {
+			this->ticks_[p] = 0;
+		}
+	}
+
+	//Event handlers
+
+	void notify(const RoundEvent&) {
+		this->rounds_++;
+	}
+
+	void notify(const TurnEvent&) {
+		this->endTurn();
+		this->turns_++;
+	}
+
+	void notify(const RollEvent& event) {
+		this->rolls_++;
+		if(event.die1 == event.die2) {
+			this->doubles_++;
+			this->turn_doubles_++;
+		}
+	}
+
+	void notify(const LandEvent&) {
+		this->landings_++;
+	}
+
+	void notify(const DrawEvent& event) {
+		this->draws_[event.deck]++;
+	}
+
+	void notify(const ArrestEvent& event) {
+		this->arrests_[event.cause]++;
+	}
+
+	void notify(const ReleaseEvent& event) {
+		this->releases_[event.cause]++;
+	}
+
+	void notify(const StayEvent&) {
+		this->stays_++;
+	}
+
+	void notify(const PhaseEvent& event) {
+		unsigned long long now = StatsObserver::tick();
+		this->ticks_[this->phase_] += now - this->last_tick_;
+		this->last_tick_ = now;
+		this->phase_ = event.phase;
+	}
+
+	//Accessor methods
+
+	long long rounds() const { return this->rounds_; }
+	long long turns() const { return this->turns_; }
+	long long rolls() const { return this->rolls_; }
+	long long doubles() const { return this->doubles_; }
+	long long landings() const { return this->landings_; }
+	long long stays() const { return this->stays_; }
+	long long draws(CardDecks::Deck deck) const { return this->draws_[deck]; }
+	long long arrests(ArrestEvent::Cause cause) const { return this->arrests_[cause]; }
+	long long releases(ReleaseEvent::Cause cause) const { return this->releases_[cause]; }
+	unsigned long long ticks(PhaseEvent::Phase phase) const { return this->ticks_[phase]; }
+
+	/* Returns the number of finished turns that rolled the given number of doubles */
+	long long turnsByDoubles(int doubles) const { return this->turns_by_doubles_[doubles]; }
+
+	/* Outputs a summary of the counters and timers */
+	void print(ostream& output) const {
+		output << "Rounds: " << this->rounds_ << " Turns: " << this->turns_ << "\n";
+		output << "Rolls: " << this->rolls_ << " Doubles: " << this->doubles_ << "\n";
+		output << "Turns by doubles rolled:";
+		for(int d = 0; d <= MAXIMUM_DOUBLES; d++) {
+			//The last turn has not been finished by another TurnEvent
+			bool last = (this->turns_ > 0 && d == this->turn_doubles_);
+			output << " " << d << ": " << this->turns_by_doubles_[d] + (last ? 1 : 0);
+		}
+		output << "\n";
+		output << "Landings: " << this->landings_ << "\n";
+		output << "Card draws: Chance " << this->draws_[CardDecks::CHANCE_DECK];
+		output << " Community Chest " << this->draws_[CardDecks::COMMUNITY_CHEST_DECK] << "\n";
+		output << "Arrests: Go To Jail " << this->arrests_[ArrestEvent::GO_TO_JAIL_PROPERTY];
+		output << " Go to Jail card " << this->arrests_[ArrestEvent::GO_TO_JAIL_CARD];
+		output << " Third doubles " << this->arrests_[ArrestEvent::THIRD_DOUBLES] << "\n";
+		output << "Releases: Doubles " << this->releases_[ReleaseEvent::DOUBLES];
+		output << " Sentence served " << this->releases_[ReleaseEvent::SENTENCE_SERVED];
+		output << " Get Out of Jail Free " << this->releases_[ReleaseEvent::GET_OUT_OF_JAIL_FREE] << "\n";
+		output << "Stays in Jail: " << this->stays_ << "\n";
+		//Phase timers, as a share of the total
+		const char* names[PhaseEvent::PHASE_COUNT] = { "Between turns", "Dice", "Movement", "Tile", "Cards", "Jail" };
+		unsigned long long total = 0;
+		for(int p = 0; p < PhaseEvent::PHASE_COUNT; p++) {
+			total += this->ticks_[p];
+		}
+		output << "Phase timers (" << StatsObserver::TICK_UNIT << "):\n";
+		for(int p = 0; p < PhaseEvent::PHASE_COUNT; p++) {
+			output << "  " << left << setw(16) << names[p] << right << setw(16) << this->ticks_[p];
+			output << fixed << setprecision(1) << setw(8) << (total ? 100.0 * this->ticks_[p] / total : 0.0) << "%\n";
+		}
+	}
+
+private:
+
+	//Arrests and releases each have three causes
+	static const int CAUSE_COUNT = 3;
+
+	/*** Private member variables ***/
+
+	long long rounds_;
+	long long turns_;
+	long long rolls_;
+	long long doubles_;
+	long long landings_;
+	long long stays_;
+	long long draws_[CardDecks::DECK_COUNT];
+	long long arrests_[CAUSE_COUNT];
+	long long releases_[CAUSE_COUNT];
+
+	//Doubles rolled so far in the current turn, and finished turns by doubles rolled
+	int turn_doubles_;
+	long long turns_by_doubles_[MAXIMUM_DOUBLES + 1];
+
+	//The current phase, when it started, and the time charged to each phase
+	PhaseEvent::Phase phase_;
+	unsigned long long last_tick_;
+	unsigned long long ticks_[PhaseEvent::PHASE_COUNT];
+
+	/*** Private method implementation ***/
+
+	/* Records the doubles rolled by the turn that just ended (if any) */
+	void endTurn() {
+		if(this->turns_ > 0) {
+			this->turns_by_doubles_[this->turn_doubles_]++;
+		}
+		this->turn_doubles_ = 0;
+	}
+
+#if defined(__x86_64__) || defined(__i386__)
+	static constexpr const char* TICK_UNIT = "cycles";
+	static unsigned long long tick() { return __rdtsc(); }
+#else
+	static constexpr const char* TICK_UNIT = "ns";
+	static unsigned long long tick() {
+		return chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now().time_since_epoch()).count();
+	}
+#endif
+
+};
+
+#endif
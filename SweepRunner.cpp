@@ -0,0 +1,229 @@
+/**
+ * @file SweepRunner.cpp
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Contains implementation of the public interface and private methods of
+ * the SweepRunner class. For details about this class, see 'SweepRunner.h'.
+ */
+
+//Protected includes
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+//Class header include
+#include "SweepRunner.h"
+
+//Class dependencies
+#include "SimulatorConfig.h"
+#include "Board.h"
+#include "BatchSimulator.h"
+#include "CardDecks.h"
+
+using namespace std;
+
+//The shuffle policies' names, as given to '--shuffle', indexed by CardDecks::Shuffle
+static const char* SHUFFLE_NAMES[] = { "none", "start", "exhausted" };
+
+/*** Public interface implementation ***/
+
+/**
+ * SweepRunner class constructor. Accepts an existing SimulatorConfig object
+ * describing the sweep (its axes, the games played at each point, and the number
+ * of worker threads), and lays out the sweep's points and blocks.
+ *
+ * @param 	config 	An existing SimulatorConfig object
+ */
+SweepRunner::SweepRunner(SimulatorConfig config) : config_(config), boards_(config.sweepBoards()), next_block_(0) {
+	this->thread_count_ = this->config_.threadCount();
+	if(this->thread_count_ == 0) {
+		//Use every core (hardware_concurrency() may not know, and return 0)
+		this->thread_count_ = thread::hardware_concurrency();
+		if(this->thread_count_ == 0) {
+			this->thread_count_ = 1;
+		}
+	}
+	//Points in grid order, with the boards varying slowest and the seeds fastest
+	vector<CardDecks::Shuffle> shuffles = this->config_.sweepShuffles();
+	vector<int> players = this->config_.sweepPlayers();
+	vector<int> turns = this->config_.sweepTurns();
+	vector<int> seeds = this->config_.sweepSeeds();
+	for(unsigned int b = 0; b < this->boards_.size(); b++) {
+		for(unsigned int h = 0; h < shuffles.size(); h++) {
+			for(unsigned int p = 0; p < players.size(); p++) {
+				for(unsigned int t = 0; t < turns.size(); t++) {
+					Group group = { (int)b, shuffles[h], players[p], turns[t], (int)this->points_.size(), (int)seeds.size() };
+					this->groups_.push_back(group);
+					for(unsigned int s = 0; s < seeds.size(); s++) {
+						Point point;
+						point.board = (int)b;
+						point.shuffle = shuffles[h];
+						point.player_count = players[p];
+						point.turn_count = turns[t];
+						point.seed = seeds[s];
+						for(int i = 0; i < this->boards_[b]->size(); i++) {
+							point.counts[i] = 0;
+						}
+						this->points_.push_back(point);
+					}
+				}
+			}
+		}
+	}
+	//Cut each group's games into blocks, and start on the longest blocks first
+	long long games = this->config_.gameCount();
+	for(unsigned int g = 0; g < this->groups_.size(); g++) {
+		long long group_games = this->groups_[g].point_count * games;
+		for(long long first = 0; first < group_games; first += BatchSimulator::LANES) {
+			Block block = { (int)g, first, (int)min<long long>(group_games - first, BatchSimulator::LANES) };
+			this->blocks_.push_back(block);
+		}
+	}
+	stable_sort(this->blocks_.begin(), this->blocks_.end(), [this](const Block& a, const Block& b) {
+		const Group& x = this->groups_[a.group];
+		const Group& y = this->groups_[b.group];
+		return (long long)x.player_count * x.turn_count * a.lanes > (long long)y.player_count * y.turn_count * b.lanes;
+	});
+}
+
+//SweepRunner class destructor
+SweepRunner::~SweepRunner() { }
+
+/* Plays every point of the sweep and records the resulting table */
+void SweepRunner::runSimulation() {
+	this->simulatePoints();
+	ofstream output_handle;
+	output_handle.open(this->config_.outputPath().c_str(), ofstream::out | ofstream::trunc);
+	if(!output_handle.is_open()) {
+		throw runtime_error("Exception occured when opening a file for writing.\n\n");
+	}
+	output_handle << "Points: " << this->pointCount() << " ";
+	output_handle << "Games: " << this->config_.gameCount() << "\n";
+	this->printTable(output_handle);
+	output_handle << "\n";
+}
+
+/* Plays every point of the sweep on the worker threads, rethrowing the first
+ * exception thrown by any of them once they have all stopped
+ */
+void SweepRunner::simulatePoints() {
+	for(unsigned int p = 0; p < this->points_.size(); p++) {
+		for(int i = 0; i < this->boards_[this->points_[p].board]->size(); i++) {
+			this->points_[p].counts[i] = 0;
+		}
+	}
+	this->next_block_ = 0;
+	this->error_ = nullptr;
+	//The calling thread doubles as the first worker
+	vector<thread> threads;
+	for(int w = 1; w < this->thread_count_ && w < (int)this->blocks_.size(); w++) {
+		threads.push_back(thread(&SweepRunner::work, this));
+	}
+	this->work();
+	for(unsigned int t = 0; t < threads.size(); t++) {
+		threads[t].join();
+	}
+	if(this->error_) {
+		rethrow_exception(this->error_);
+	}
+}
+
+/**
+ * Outputs a tab-separated table with one row of landing counts per point. When
+ * more than one board or shuffle policy is swept, each pair of them gets its own
+ * table (as boards may differ in their tiles), headed by the board's name and the
+ * shuffle policy.
+ */
+void SweepRunner::printTable(ostream& output) const {
+	bool captioned = this->boards_.size() > 1 || this->config_.sweepShuffles().size() > 1;
+	for(unsigned int p = 0; p < this->points_.size(); p++) {
+		const Point& point = this->points_[p];
+		const BoardDefinition& board = *this->boards_[point.board];
+		if(p == 0 || point.board != this->points_[p - 1].board || point.shuffle != this->points_[p - 1].shuffle) {
+			output << "\n";
+			if(captioned) {
+				output << "Board: " << board.name() << " ";
+				output << "Shuffle: " << SHUFFLE_NAMES[point.shuffle] << "\n";
+			}
+			output << "Players\tTurns\tSeed";
+			for(int i = 0; i < board.size(); i++) {
+				output << "\t" << board.tileName(i);
+			}
+			output << "\n";
+		}
+		output << point.player_count << "\t" << point.turn_count << "\t" << point.seed;
+		for(int i = 0; i < board.size(); i++) {
+			output << "\t" << point.counts[i];
+		}
+		output << "\n";
+	}
+}
+
+/*** Private method implementation ***/
+
+/**
+ * Worker thread body. Takes blocks from the shared counter until there are none
+ * left, plays each one on a private BatchSimulator for its board, and adds the counts of every
+ * game to its point. An exception is kept for simulatePoints() to rethrow, and
+ * stops every worker from taking more blocks; it must not escape a thread.
+ */
+void SweepRunner::work() {
+	try {
+		this->playBlocks();
+	} catch(...) {
+		lock_guard<mutex> guard(this->merge_lock_);
+		if(!this->error_) {
+			this->error_ = current_exception();
+		}
+		this->next_block_ = (int)this->blocks_.size();
+	}
+}
+
+/* Plays blocks from the shared counter until there are none left (see work()) */
+void SweepRunner::playBlocks() {
+	//Each board's BatchSimulator (built on its first block), and the group it was last configured for
+	vector<unique_ptr<BatchSimulator>> batches(this->boards_.size());
+	vector<int> configured_group(this->boards_.size(), -1);
+	BatchSimulator::Game games[BatchSimulator::LANES];
+	int point_of[BatchSimulator::LANES];
+	vector<unsigned long long> game_counts(BatchSimulator::LANES * Board::MAXIMUM_SIZE);
+	long long games_per_point = this->config_.gameCount();
+	for(int b = this->next_block_++; b < (int)this->blocks_.size(); b = this->next_block_++) {
+		const Block& block = this->blocks_[b];
+		const Group& group = this->groups_[block.group];
+		int board_size = this->boards_[group.board]->size();
+		if(configured_group[group.board] != block.group) {
+			SimulatorConfig config = this->config_.onBoard(group.board, group.shuffle)
+				.atPoint(group.player_count, group.turn_count, this->points_[group.first_point].seed);
+			if(!batches[group.board]) {
+				batches[group.board].reset(new BatchSimulator(config));
+			} else {
+				batches[group.board]->reconfigure(config);
+			}
+			configured_group[group.board] = block.group;
+		}
+		BatchSimulator& batch = *batches[group.board];
+		//The block's games, laid end to end across its group's points
+		for(int l = 0; l < block.lanes; l++) {
+			long long k = block.first + l;
+			point_of[l] = group.first_point + (int)(k / games_per_point);
+			games[l].seed = (unsigned long long)this->points_[point_of[l]].seed;
+			games[l].index = this->config_.firstGame() + (int)(k % games_per_point);
+		}
+		fill(game_counts.begin(), game_counts.end(), 0);
+		batch.simulateGames(games, block.lanes, game_counts.data());
+		lock_guard<mutex> guard(this->merge_lock_);
+		for(int l = 0; l < block.lanes; l++) {
+			for(int i = 0; i < board_size; i++) {
+				this->points_[point_of[l]].counts[i] += game_counts[l * board_size + i];
+			}
+		}
+	}
+}
@@ -0,0 +1,108 @@
+/**
+ * @file SweepRunner.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Describes the public interface and private methods of the SweepRunner class.
+ * The runner plays every point of a grid of boards, shuffle policies, player
+ * counts, turn counts and seeds (each point being one or more games) in a single
+ * process, and writes one table per board and shuffle policy, with a row of
+ * landing counts per point.
+ *
+ * Points that share a board, shuffle policy, player count and turn count form a
+ * group, and are played together: their games are laid end to end and cut into
+ * blocks of BatchSimulator::LANES games, so that the lanes of one block may belong
+ * to many different seeds. Blocks are handed out to a pool of worker threads,
+ * largest first, from a shared counter; each worker keeps one BatchSimulator per
+ * board for the whole sweep, and only reconfigures it when a block belongs to a
+ * different group than the last one played on that board, so each board's tables
+ * are built once per worker.
+ *
+ * Every game draws from its own random streams, so a point's row holds exactly
+ * the counts that a separate run of that point would report.
+ */
+
+#ifndef SWEEP_RUNNER_H
+#define SWEEP_RUNNER_H
+
+//Protected includes (for arguments and return types)
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <ostream>
+#include <vector>
+#include "SimulatorConfig.h"
+#include "Board.h"
+#include "BoardDefinition.h"
+#include "CardDecks.h"
+
+class SweepRunner {
+
+public:
+
+	/* One point of the sweep, with its landing counts summed over the point's games */
+	struct Point {
+		int board;
+		CardDecks::Shuffle shuffle;
+		int player_count;
+		int turn_count;
+		int seed;
+		unsigned long long counts[Board::MAXIMUM_SIZE];
+	};
+
+	//SweepRunner class constructor
+	SweepRunner(SimulatorConfig config);
+	//SweepRunner class destructor
+	~SweepRunner();
+
+	void runSimulation();
+	void simulatePoints();
+
+	//Accessor methods
+	int threadCount() const { return this->thread_count_; }
+	int pointCount() const { return (int)this->points_.size(); }
+	const Point& point(int n) const { return this->points_[n]; }
+	void printTable(ostream& output) const;
+
+private:
+
+	/* Consecutive points that share a board, shuffle policy, player and turn count */
+	struct Group {
+		int board;
+		CardDecks::Shuffle shuffle;
+		int player_count;
+		int turn_count;
+		int first_point;
+		int point_count;
+	};
+
+	/* Up to LANES consecutive games of a Group */
+	struct Block {
+		int group;
+		long long first;
+		int lanes;
+	};
+
+	/*** Private member variables ***/
+
+	SimulatorConfig config_;
+	int thread_count_;
+	//The boards swept over, indexed by Point::board
+	vector<shared_ptr<const BoardDefinition>> boards_;
+
+	vector<Point> points_;
+	vector<Group> groups_;
+	vector<Block> blocks_;
+	atomic<int> next_block_;
+	mutex merge_lock_;
+	//The first exception thrown by a worker, rethrown by simulatePoints()
+	exception_ptr error_;
+
+	/*** Private method implementation ***/
+
+	void work();
+	void playBlocks();
+
+};
+
+#endif
@@ -0,0 +1,90 @@
+/**
+ * @file TextObserver.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Describes and implements the TextObserver class, which writes each Simulator
+ * event to an output stream as a line of text. This is the play-by-play that the
+ * Simulator records in verbose mode.
+ */
+
+#ifndef TEXT_OBSERVER_H
+#define TEXT_OBSERVER_H
+
+//Protected includes
+#include <ostream>
+#include "SimulatorEvents.h"
+#include "CardDecks.h"
+
+using namespace std;
+
+class TextObserver {
+
+public:
+
+	/**
+	 * TextObserver class constructor.
+	 *
+	 * @param 	output 	The stream to write events to
+	 */
+	TextObserver(ostream& output) : output_(output) { }
+
+	/* Outputs a round label for a given round */
+	void notify(const RoundEvent& event) {
+		this->output_ << "++++++++++++++++++++\n";
+		this->output_ << "Starting round " << (event.round + 1) << "\n";
+	}
+
+	void notify(const TurnEvent& event) {
+		this->output_ << "Player " << event.player << " starting on ";
+		this->output_ << event.property.name() << "\n";
+	}
+
+	void notify(const RollEvent& event) {
+		this->output_ << "Player " << event.player << " rolls ";
+		this->output_ << event.die1 << "+" << event.die2 << "\n";
+	}
+
+	void notify(const LandEvent& event) {
+		this->output_ << "Player " << event.player << " landed on ";
+		this->output_ << event.property.name() << "\n";
+	}
+
+	void notify(const DrawEvent& event) {
+		if(event.deck == CardDecks::CHANCE_DECK) {
+			this->output_ << " -> Chance - " << event.card.description() << "\n";
+		} else {
+			this->output_ << "Player " << event.player << " drew a ";
+			this->output_ << "'" << event.card.description() << "'\n";
+		}
+	}
+
+	void notify(const ArrestEvent& event) {
+		if(event.cause == ArrestEvent::THIRD_DOUBLES) {
+			this->output_ << "Player " << event.player << " has rolled 'doubles' three times!\n";
+		}
+		this->output_ << " -> Player " << event.player << " is hauled off to Jail!\n";
+	}
+
+	void notify(const ReleaseEvent& event) {
+		if(event.cause == ReleaseEvent::GET_OUT_OF_JAIL_FREE) {
+			this->output_ << "Player " << event.player << " uses his ";
+			this->output_ << "'Get Out of Jail Free' card to leave Jail.\n";
+		} else {
+			this->output_ << " -> Player " << event.player << " was released from Jail!\n";
+		}
+	}
+
+	void notify(const StayEvent& event) {
+		this->output_ << " -> Player " << event.player << " spends another lonely night in Jail.\n";
+	}
+
+	void notify(const PhaseEvent&) { }
+
+private:
+
+	ostream& output_;
+
+};
+
+#endif
@@ -0,0 +1,197 @@
+/**
+ * @file Trace.cpp
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Contains implementation of the public interface and private methods of the
+ * TraceWriter and TraceReader classes. For details about the trace format, see
+ * 'Trace.h'.
+ */
+
+//Protected includes
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+//Class header include
+#include "Trace.h"
+
+//Class dependencies
+#include "SimulatorConfig.h"
+#include "Board.h"
+#include "BoardDefinition.h"
+#include "Property.h"
+#include "Card.h"
+#include "CardDecks.h"
+
+using namespace std;
+
+/*** TraceWriter implementation ***/
+
+/**
+ * TraceWriter class constructor. Creates (or truncates) the trace file and
+ * writes the header, recording the simulation settings, the board and the decks.
+ *
+ * @param 	path 	The path of the trace file
+ * @param 	config 	The simulation's settings, including its BoardDefinition
+ */
+TraceWriter::TraceWriter(const string& path, const SimulatorConfig& config)
+: board_size_(config.board()->size()), jail_location_(config.board()->jailLocation()) {
+	if(config.playerCount() > Trace::MAXIMUM_PLAYERS) {
+		throw invalid_argument("Too many players to record in a trace!");
+	}
+	this->output_.open(path);
+	for(int p = 0; p < Trace::MAXIMUM_PLAYERS; p++) {
+		this->location_[p] = 0;
+	}
+	//Format and settings
+	for(int i = 0; i < 4; i++) {
+		this->put(Trace::MAGIC[i]);
+	}
+	this->putVarint(Trace::VERSION);
+	this->putVarint(config.playerCount());
+	this->putVarint(config.turnCount());
+	this->putSigned(config.resolvedSeed());
+	this->putVarint(config.firstGame());
+	//Board
+	const BoardDefinition& board = *config.board();
+	this->putVarint(board.size());
+	for(int i = 0; i < board.size(); i++) {
+		this->putVarint(board.kind(i));
+		this->putString(board.tileName(i));
+	}
+	//Decks
+	this->putVarint(CardDecks::DECK_COUNT);
+	for(int d = 0; d < CardDecks::DECK_COUNT; d++) {
+		this->putVarint(board.deckSize((CardDecks::Deck)d));
+		for(int id = 0; id < board.deckSize((CardDecks::Deck)d); id++) {
+			const Card& card = board.card((CardDecks::Deck)d, id);
+			this->putVarint(card.effect());
+			this->putSigned(card.argument());
+			this->putString(card.description());
+		}
+	}
+}
+
+/* TraceWriter class destructor. Writes any pending records and closes the file,
+ * if close() hasn't already; a failed write can only be reported by close().
+ */
+TraceWriter::~TraceWriter() { }
+
+/* Writes any pending records and closes the file. Throws a runtime_error if
+ * any of the records couldn't be written.
+ */
+void TraceWriter::close() {
+	this->output_.close();
+}
+
+/* Writes an unsigned integer as an LEB128 varint */
+void TraceWriter::putVarint(unsigned long long value) {
+	while(value >= 0x80) {
+		this->put((unsigned char)(value | 0x80));
+		value >>= 7;
+	}
+	this->put((unsigned char)value);
+}
+
+/* Writes a signed integer as a zigzag-encoded varint */
+void TraceWriter::putSigned(long long value) {
+	this->putVarint(((unsigned long long)value << 1) ^ (unsigned long long)(value >> 63));
+}
+
+/* Writes a string, prefixed by its length */
+void TraceWriter::putString(const string& value) {
+	this->putVarint(value.size());
+	for(unsigned int i = 0; i < value.size(); i++) {
+		this->put(value[i]);
+	}
+}
+
+/*** TraceReader implementation ***/
+
+/**
+ * TraceReader class constructor. Opens a trace file and reads its header.
+ * Throws a runtime_error if the file can't be opened, or isn't a trace.
+ *
+ * @param 	path 	The path of the trace file
+ */
+TraceReader::TraceReader(const string& path) {
+	this->input_.open(path.c_str(), ifstream::in | ifstream::binary);
+	if(!this->input_.is_open()) {
+		throw runtime_error("Exception occured when opening a file for reading.\n\n");
+	}
+	//Format and settings
+	for(int i = 0; i < 4; i++) {
+		if(this->get() != Trace::MAGIC[i]) {
+			throw runtime_error("The file is not a trace!");
+		}
+	}
+	if(this->getVarint() != Trace::VERSION) {
+		throw runtime_error("The trace was written in an unsupported version of the format!");
+	}
+	this->player_count_ = this->getVarint();
+	this->turn_count_ = this->getVarint();
+	this->seed_ = this->getSigned();
+	this->first_game_ = this->getVarint();
+	//Board
+	int board_size = this->getVarint();
+	for(int i = 0; i < board_size; i++) {
+		Property::Kind kind = (Property::Kind)this->getVarint();
+		this->strings_.push_back(this->getString());
+		this->board_.addProperty(this->strings_.back().c_str(), kind);
+	}
+	if(this->board_.jailLocation() == -1) {
+		throw runtime_error("The trace's board has no Jail!");
+	}
+	//Decks
+	if(this->getVarint() != CardDecks::DECK_COUNT) {
+		throw runtime_error("The trace holds an unexpected number of decks!");
+	}
+	for(int d = 0; d < CardDecks::DECK_COUNT; d++) {
+		int deck_size = this->getVarint();
+		for(int id = 0; id < deck_size; id++) {
+			Card::Effect effect = (Card::Effect)this->getVarint();
+			int argument = this->getSigned();
+			this->strings_.push_back(this->getString());
+			this->cards_[d].push_back(Card(this->strings_.back().c_str(), effect, argument));
+		}
+	}
+}
+
+/* Reads one byte. Throws a runtime_error if the trace ends early. */
+int TraceReader::get() {
+	int byte = this->input_.get();
+	if(byte == EOF) {
+		throw runtime_error("The trace ends in the middle of a record!");
+	}
+	return byte;
+}
+
+/* Reads an LEB128 varint */
+unsigned long long TraceReader::getVarint() {
+	unsigned long long value = 0;
+	for(int shift = 0; shift < 64; shift += 7) {
+		int byte = this->get();
+		value |= (unsigned long long)(byte & 0x7f) << shift;
+		if(!(byte & 0x80)) {
+			return value;
+		}
+	}
+	throw runtime_error("The trace holds a malformed varint!");
+}
+
+/* Reads a zigzag-encoded varint */
+long long TraceReader::getSigned() {
+	unsigned long long value = this->getVarint();
+	return (long long)(value >> 1) ^ -(long long)(value & 1);
+}
+
+/* Reads a string, prefixed by its length */
+string TraceReader::getString() {
+	unsigned long long length = this->getVarint();
+	string value;
+	for(unsigned long long i = 0; i < length; i++) {
+		value += (char)this->get();
+	}
+	return value;
+}
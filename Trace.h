@@ -0,0 +1,258 @@
+/**
+ * @file Trace.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Describes the binary trace format, and the TraceWriter and TraceReader classes
+ * that produce and consume it. A trace records every event of a verbose run in a
+ * few bytes per event, in place of a line of text.
+ *
+ * A trace begins with a header: the magic bytes "MSTR", a format version, the
+ * simulation's settings, the board (each Property's kind and name) and the card
+ * decks (each card's effect, argument and description), as given by the run's
+ * BoardDefinition. A reader rebuilds the Board from the header alone, and finds
+ * the Jail by its kind, so traces of any board can be replayed. Strings are
+ * prefixed by their length; integers are written as unsigned LEB128 varints,
+ * with signed values zigzag-encoded first.
+ *
+ * The header is followed by one record per event. Every record starts with a tag
+ * byte: bits 0-2 hold the event kind, bits 3-4 an arrest/release cause or a deck,
+ * and bits 5-7 the Player. Most records are just the tag; the rest are fixed-width
+ * except for landings, which store the distance travelled as a varint:
+ *
+ * 		ROUND 		tag 				(rounds are numbered in order)
+ * 		TURN 		tag 				(the Player starts where they last stopped)
+ * 		ROLL 		tag, dice 			(dice = (die1 - 1) * 6 + (die2 - 1))
+ * 		LAND 		tag, varint 		(spaces moved forward since the last stop)
+ * 		DRAW 		tag, card 			(the deck is in the tag)
+ * 		ARREST 		tag 				(the Player is now at the board's Jail)
+ * 		RELEASE 	tag
+ * 		STAY 		tag
+ *
+ * Since Player locations are implied by the records, a reader can replay the
+ * events (and recount the landings) without any other information.
+ */
+
+#ifndef TRACE_H
+#define TRACE_H
+
+//Protected includes
+#include <cstdio>
+#include <deque>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "lib/AsyncFileBuffer.h"
+#include "SimulatorConfig.h"
+#include "SimulatorEvents.h"
+#include "Board.h"
+#include "Card.h"
+#include "CardDecks.h"
+
+using namespace std;
+
+namespace Trace {
+
+	const char MAGIC[4] = { 'M', 'S', 'T', 'R' };
+	const int VERSION = 2;
+
+	//Players are stored in three bits of the tag
+	const int MAXIMUM_PLAYERS = 8;
+
+	//Record kinds, stored in the low three bits of the tag
+	enum Kind { ROUND, TURN, ROLL, LAND, DRAW, ARREST, RELEASE, STAY };
+
+	/* Packs a record's kind, detail (cause or deck) and Player into a tag byte */
+	inline unsigned char tag(Kind kind, int detail, int player) {
+		return (unsigned char)(kind | (detail << 3) | (player << 5));
+	}
+
+};
+
+class TraceWriter {
+
+public:
+
+	//TraceWriter class constructor; writes the trace header
+	TraceWriter(const string& path, const SimulatorConfig& config);
+	//TraceWriter class destructor; waits for the records to reach the file
+	~TraceWriter();
+
+	void close();
+
+	void notify(const RoundEvent&) {
+		this->put(Trace::tag(Trace::ROUND, 0, 0));
+	}
+
+	void notify(const TurnEvent& event) {
+		this->put(Trace::tag(Trace::TURN, 0, event.player));
+	}
+
+	void notify(const RollEvent& event) {
+		this->put(Trace::tag(Trace::ROLL, 0, event.player));
+		this->put((unsigned char)((event.die1 - 1) * 6 + (event.die2 - 1)));
+	}
+
+	void notify(const LandEvent& event) {
+		int distance = event.index - this->location_[event.player];
+		distance += (distance < 0) ? this->board_size_ : 0;
+		this->put(Trace::tag(Trace::LAND, 0, event.player));
+		this->putVarint(distance);
+		this->location_[event.player] = event.index;
+	}
+
+	void notify(const DrawEvent& event) {
+		this->put(Trace::tag(Trace::DRAW, event.deck, event.player));
+		this->put((unsigned char)event.id);
+	}
+
+	void notify(const ArrestEvent& event) {
+		this->put(Trace::tag(Trace::ARREST, event.cause, event.player));
+		this->location_[event.player] = this->jail_location_;
+	}
+
+	void notify(const ReleaseEvent& event) {
+		this->put(Trace::tag(Trace::RELEASE, event.cause, event.player));
+	}
+
+	void notify(const StayEvent& event) {
+		this->put(Trace::tag(Trace::STAY, 0, event.player));
+	}
+
+	void notify(const PhaseEvent&) { }
+
+private:
+
+	//Records are written to the file from a background thread
+	AsyncFileBuffer output_;
+
+	//Each Player's last stop, for delta-encoding landings
+	int board_size_;
+	int jail_location_;
+	int location_[Trace::MAXIMUM_PLAYERS];
+
+	void put(unsigned char byte) {
+		this->output_.sputc((char)byte);
+	}
+
+	void putVarint(unsigned long long value);
+	void putSigned(long long value);
+	void putString(const string& value);
+
+};
+
+class TraceReader {
+
+public:
+
+	//TraceReader class constructor; reads and checks the trace header
+	TraceReader(const string& path);
+
+	//Accessor methods (recorded settings)
+	int playerCount() const { return this->player_count_; }
+	int turnCount() const { return this->turn_count_; }
+	int seed() const { return this->seed_; }
+	int firstGame() const { return this->first_game_; }
+
+	//Accessor methods (recorded Board and decks)
+	const Board& board() const { return this->board_; }
+	int deckSize(int deck) const { return (int)this->cards_[deck].size(); }
+	const Card& card(int deck, int id) const { return this->cards_[deck][id]; }
+
+	template<class Observer> void replay(Observer& observer);
+
+private:
+
+	ifstream input_;
+
+	int player_count_;
+	int turn_count_;
+	int seed_;
+	int first_game_;
+
+	//The recorded Board, which also collects landing counts during a replay
+	Board board_;
+	//The recorded decks; strings_ owns the Properties' names and the Cards' descriptions
+	vector<Card> cards_[CardDecks::DECK_COUNT];
+	deque<string> strings_;
+
+	int get();
+	unsigned long long getVarint();
+	long long getSigned();
+	string getString();
+
+};
+
+/*** Template implementation ***/
+
+/**
+ * Reads every record after the header, and hands the corresponding event to
+ * the observer. The landings are also counted on the recorded Board, exactly as
+ * the Simulator counted them. Throws a runtime_error on a malformed record.
+ *
+ * @param 	observer 	An observer (see 'SimulatorEvents.h')
+ */
+template<class Observer> void TraceReader::replay(Observer& observer) {
+	int location[Trace::MAXIMUM_PLAYERS] = { 0 };
+	int round = 0;
+	int tag;
+	while((tag = this->input_.get()) != EOF) {
+		int detail = (tag >> 3) & 3;
+		int player = tag >> 5;
+		if(player >= this->player_count_) {
+			throw runtime_error("The trace holds a record for an unknown Player!");
+		}
+		switch(tag & 7) {
+			case Trace::ROUND:
+				observer.notify(RoundEvent{ round++ });
+				break;
+			case Trace::TURN:
+				observer.notify(TurnEvent{ player, this->board_.propertyAt(location[player]) });
+				break;
+			case Trace::ROLL: {
+				int dice = this->get();
+				observer.notify(RollEvent{ player, dice / 6 + 1, dice % 6 + 1 });
+				break;
+			}
+			case Trace::LAND: {
+				int index = (location[player] + (int)this->getVarint()) % this->board_.size();
+				Property& property = this->board_.propertyAt(index);
+				location[player] = index;
+				observer.notify(LandEvent{ player, index, property });
+				property.incrementCount();
+				break;
+			}
+			case Trace::DRAW: {
+				int id = this->get();
+				if(detail >= CardDecks::DECK_COUNT) {
+					throw runtime_error("The trace holds a record for an unknown deck!");
+				}
+				if(id >= this->deckSize(detail)) {
+					throw runtime_error("The trace holds a record for an unknown card!");
+				}
+				observer.notify(DrawEvent{ player, (CardDecks::Deck)detail, id, this->card(detail, id) });
+				break;
+			}
+			case Trace::ARREST:
+				if(detail > ArrestEvent::THIRD_DOUBLES) {
+					throw runtime_error("The trace holds an arrest with an unknown cause!");
+				}
+				location[player] = this->board_.jailLocation();
+				this->board_.propertyAt(location[player]).incrementCount();
+				observer.notify(ArrestEvent{ player, (ArrestEvent::Cause)detail });
+				break;
+			case Trace::RELEASE:
+				if(detail > ReleaseEvent::GET_OUT_OF_JAIL_FREE) {
+					throw runtime_error("The trace holds a release with an unknown cause!");
+				}
+				observer.notify(ReleaseEvent{ player, (ReleaseEvent::Cause)detail });
+				break;
+			case Trace::STAY:
+				observer.notify(StayEvent{ player });
+				break;
+		}
+	}
+}
+
+#endif
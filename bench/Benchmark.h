@@ -0,0 +1,111 @@
+/**
+ * @file Benchmark.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Describes and implements the Benchmark class, a small harness for timing the
+ * simulator's hot paths. A benchmark runs its body a fixed number of times per
+ * sample, and takes SAMPLES samples after one untimed warm-up sample. It reports
+ * the median time per operation, the dispersion of the samples (the median
+ * absolute deviation, as a percentage of the median) and the resulting number
+ * of operations per second. Medians are used rather than means so that a single
+ * sample disturbed by the rest of the system does not move the result.
+ *
+ * Every body returns a value that is folded into sink(), so the compiler can't
+ * discard the work being timed.
+ */
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+//Protected includes
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+class Benchmark {
+
+public:
+
+	//Timed samples taken of every benchmark
+	static const int SAMPLES = 9;
+
+	/* The result of a benchmark: median seconds per operation, and dispersion */
+	struct Result {
+		double median;
+		double deviation;
+	};
+
+	/**
+	 * Times a body, and prints a line of the report.
+	 *
+	 * @param 	name 		The benchmark's name
+	 * @param 	unit 		What one operation is (e.g. "call", "turn")
+	 * @param 	operations 	The number of operations performed per sample
+	 * @param 	body 		Called once per sample; performs the operations and
+	 * 						returns a value that depends on them
+	 */
+	template<class Body> static Result run(const string& name, const string& unit,
+		long long operations, Body body) {
+		vector<double> samples;
+		Benchmark::sink(body());
+		for(int s = 0; s < SAMPLES; s++) {
+			chrono::steady_clock::time_point start = chrono::steady_clock::now();
+			Benchmark::sink(body());
+			chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+			samples.push_back(elapsed.count() / operations);
+		}
+		Result result;
+		result.median = Benchmark::median(samples);
+		for(unsigned int s = 0; s < samples.size(); s++) {
+			samples[s] = fabs(samples[s] - result.median);
+		}
+		result.deviation = Benchmark::median(samples);
+		Benchmark::print(name, unit, result);
+		return result;
+	}
+
+	/* Prints the report's column headings */
+	static void printHeader(const string& title) {
+		cout << "\n" << title << "\n";
+		cout << left << setw(44) << "benchmark" << right << setw(14) << "median" << setw(10) << "+/-";
+		cout << setw(18) << "rate" << "\n";
+	}
+
+	/* Keeps a value alive, so that the work producing it is not optimized away */
+	static void sink(long long value) {
+		static volatile long long sunk = 0;
+		sunk = sunk + value;
+	}
+
+private:
+
+	static double median(vector<double> samples) {
+		sort(samples.begin(), samples.end());
+		int middle = (int)samples.size() / 2;
+		return (samples.size() % 2) ? samples[middle] : (samples[middle - 1] + samples[middle]) / 2;
+	}
+
+	static void print(const string& name, const string& unit, const Result& result) {
+		cout << left << setw(44) << name << right << fixed;
+		if(result.median < 1e-6) {
+			cout << setw(11) << setprecision(2) << result.median * 1e9 << " ns";
+		} else
+		if(result.median < 1e-3) {
+			cout << setw(11) << setprecision(2) << result.median * 1e6 << " us";
+		} else {
+			cout << setw(11) << setprecision(2) << result.median * 1e3 << " ms";
+		}
+		cout << setw(9) << setprecision(1) << 100 * result.deviation / result.median << "%";
+		cout << setw(14) << setprecision(0) << 1 / result.median << " " << unit << "s/s\n";
+	}
+
+};
+
+#endif
@@ -0,0 +1,80 @@
+/**
+ * @file SimulatorBench.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Describes and implements the SimulatorBench class, which times the Simulator's
+ * turn logic directly: single die rolls, card draws and whole turns. It is a friend
+ * of the Simulator, so that these private steps can be timed on their own rather
+ * than only as part of a full run.
+ */
+
+#ifndef SIMULATOR_BENCH_H
+#define SIMULATOR_BENCH_H
+
+//Protected includes
+#include <string>
+
+//Class dependencies
+#include "../SimulatorConfig.h"
+#include "../SimulatorEvents.h"
+#include "../Simulator.h"
+#include "../CardDecks.h"
+#include "Benchmark.h"
+
+using namespace std;
+
+class SimulatorBench {
+
+public:
+
+	//Operations per sample
+	static const int ROLLS = 1 << 20;
+	static const int DRAWS = 1 << 20;
+	static const int TURNS = 1 << 18;
+
+	/* Times the Simulator's turn logic on a 4-player game */
+	static void run() {
+		const char* argv[] = { "a.out", "4", "1", "42" };
+		Simulator simulator(SimulatorConfig(4, (char**)argv));
+		NullObserver observer;
+		//Play one round, so that the Players exist
+		simulator.runSimulation(observer);
+		Player& player = *(simulator.players_[0]);
+
+		Benchmark::run("Simulator::getDiceRoll", "roll", ROLLS, [&]() {
+			long long sum = 0;
+			for(int i = 0; i < ROLLS; i++) {
+				sum += simulator.getDiceRoll(player);
+			}
+			return sum;
+		});
+
+		Benchmark::run("Simulator::drawCard", "draw", DRAWS, [&]() {
+			long long sum = 0;
+			for(int i = 0; i < DRAWS; i++) {
+				CardDecks::Deck deck = (CardDecks::Deck)(i & 1);
+				int id = simulator.drawCard(deck, player, observer);
+				//Put the card straight back, whatever it was
+				simulator.decks_[deck].push(id);
+				sum += id;
+			}
+			player.setGetOutOfJailCard(CardDecks::CHANCE_DECK, false);
+			player.setGetOutOfJailCard(CardDecks::COMMUNITY_CHEST_DECK, false);
+			return sum;
+		});
+
+		Benchmark::run("Simulator::simulateTurn", "turn", TURNS, [&]() {
+			long long sum = 0;
+			for(int i = 0; i < TURNS; i++) {
+				Player& next = *(simulator.players_[i & 3]);
+				simulator.simulateTurn(next, observer);
+				sum += next.getLocation();
+			}
+			return sum;
+		});
+	}
+
+};
+
+#endif
@@ -0,0 +1,117 @@
+/**
+ * @file main.cpp
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Runs the benchmark suite ('make bench'): microbenchmarks of the data structures
+ * and Simulator steps on the hot path, followed by end-to-end runs for every
+ * player count, with verbose output off and on. Every benchmark uses a fixed
+ * seed, so that two builds are timed on exactly the same work. See 'Benchmark.h'
+ * for how the results are measured and reported.
+ */
+
+//Protected includes
+#include <string>
+
+//Class dependencies
+#include "../SimulatorConfig.h"
+#include "../Simulator.h"
+#include "../Board.h"
+#include "../Property.h"
+#include "../lib/List.h"
+#include "../lib/Queue.h"
+#include "Benchmark.h"
+#include "SimulatorBench.h"
+
+using namespace std;
+
+//Operations per sample of the microbenchmarks
+const int LOOKUPS = 1 << 22;
+const int QUEUE_OPERATIONS = 1 << 20;
+const int LIST_SIZE = 1000;
+const int LIST_LOOKUPS = 1 << 14;
+
+//Rounds played by each end-to-end run
+const int QUIET_ROUNDS = 200000;
+const int VERBOSE_ROUNDS = 20000;
+
+/* Times the Board's lookups */
+void benchBoard() {
+	Board board;
+	board.populateClassic();
+	Benchmark::run("Board::propertyAt", "call", LOOKUPS, [&]() {
+		long long sum = 0;
+		for(int i = 0; i < LOOKUPS; i++) {
+			sum += board.propertyAt(i % 80 - 20).kind();
+		}
+		return sum;
+	});
+	Benchmark::run("Board::indexOf", "call", LOOKUPS / 16, [&]() {
+		long long sum = 0;
+		for(int i = 0; i < LOOKUPS / 16; i++) {
+			sum += board.indexOf(board.propertyAt(i));
+		}
+		return sum;
+	});
+	Benchmark::run("Board::wrapIndex", "call", LOOKUPS, [&]() {
+		long long sum = 0;
+		for(int i = 0; i < LOOKUPS; i++) {
+			sum += Board::wrapIndex(i % 100 - 30);
+		}
+		return sum;
+	});
+}
+
+/* Times the List and Queue classes */
+void benchContainers() {
+	Queue<int> queue;
+	Benchmark::run("Queue push/pop", "pair", QUEUE_OPERATIONS, [&]() {
+		long long sum = 0;
+		for(int i = 0; i < QUEUE_OPERATIONS; i++) {
+			queue.push(i);
+			sum += queue.front();
+			queue.pop();
+		}
+		return sum;
+	});
+	List<int> list;
+	for(int i = 0; i < LIST_SIZE; i++) {
+		list.pushEnd(i);
+	}
+	Benchmark::run("List::at (nodeAt, 1000 items)", "call", LIST_LOOKUPS, [&]() {
+		long long sum = 0;
+		for(int i = 0; i < LIST_LOOKUPS; i++) {
+			sum += list.at(i % LIST_SIZE);
+		}
+		return sum;
+	});
+}
+
+/* Times whole runs of the Simulator, for every player count */
+void benchRuns(bool verbose) {
+	int rounds = verbose ? VERBOSE_ROUNDS : QUIET_ROUNDS;
+	string rounds_argument = to_string(rounds);
+	for(int players = 2; players <= 6; players++) {
+		string players_argument = to_string(players);
+		const char* argv[] = { "a.out", players_argument.c_str(), rounds_argument.c_str(), "42", "-v" };
+		SimulatorConfig config(verbose ? 5 : 4, (char**)argv);
+		string name = "runSimulation " + players_argument + "p" + (verbose ? " verbose" : "");
+		Benchmark::run(name, "turn", (long long)rounds * players, [&]() {
+			//The Simulator is destroyed inside the sample, so its output is fully written
+			Simulator simulator(config);
+			simulator.runSimulation();
+			return 0LL;
+		});
+	}
+}
+
+int main() {
+	Benchmark::printHeader("Microbenchmarks");
+	benchBoard();
+	benchContainers();
+	SimulatorBench::run();
+	Benchmark::printHeader("End-to-end");
+	benchRuns(false);
+	benchRuns(true);
+	return 0;
+}
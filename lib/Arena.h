@@ -0,0 +1,184 @@
+/**
+ * @file Arena.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Describes the public interface and private methods of the Arena class. An Arena
+ * is a bump allocator: it hands out memory from large blocks, one object after
+ * another, and never frees a single object. Everything allocated from the Arena is
+ * released at once, when the Arena is reset or destroyed. Objects that need their
+ * destructor run are recorded in a list as they are created, and destroyed (newest
+ * first) on reset; objects of trivially destructible types cost nothing to release.
+ *
+ * A reset Arena keeps its blocks, so a simulation that is torn down and rebuilt in
+ * the same Arena stops touching the system allocator after its first run.
+ */
+
+#ifndef ARENA_H
+#define ARENA_H
+
+//Protected includes
+#include <cstddef>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+class Arena {
+
+public:
+
+	//Default number of bytes in each block
+	static const size_t BLOCK_SIZE = 4096;
+
+	/*** Public interface implementation ***/
+
+	//Class constructors and destructor
+
+	/**
+	 * Arena constructor. No memory is allocated until the first object is created.
+	 *
+	 * @param 	block_size 	The number of bytes to request from the system at a time
+	 */
+	Arena(size_t block_size = BLOCK_SIZE)
+	: block_size_(block_size), block_(0), offset_(0), finalizers_(NULL) {
+		if(block_size == 0) {
+			throw invalid_argument("An Arena's blocks must hold at least one byte!");
+		}
+	}
+
+	/* Arena destructor. Destroys every object, then frees every block. */
+	~Arena() {
+		this->reset();
+		for(unsigned int b = 0; b < this->blocks_.size(); b++) {
+			::operator delete(this->blocks_[b].memory);
+		}
+	}
+
+	//An Arena owns its blocks, so it may not be copied
+	Arena(const Arena&) = delete;
+	Arena& operator=(const Arena&) = delete;
+
+	//Accessor methods
+
+	/* Returns the number of blocks requested from the system so far */
+	int blockCount() const {
+		return (int)this->blocks_.size();
+	}
+
+	/* Returns the number of bytes handed out since the last reset */
+	size_t bytesUsed() const {
+		size_t used = this->offset_;
+		for(unsigned int b = 0; b < this->block_ && b < this->blocks_.size(); b++) {
+			used += this->blocks_[b].used;
+		}
+		return used;
+	}
+
+	//Mutator methods
+
+	/**
+	 * Constructs a new object of type T in the Arena, forwarding the arguments to
+	 * T's constructor, and returns a pointer to it. The object lives until the
+	 * Arena is reset or destroyed; it must not be deleted.
+	 *
+	 * @param 	args 	Arguments for T's constructor
+	 */
+	template<class T, class... Args> T* create(Args&&... args) {
+		static_assert(alignof(T) <= alignof(max_align_t), "An Arena can't hold over-aligned types");
+		void* memory = this->allocate(sizeof(T), alignof(T));
+		T* object = new(memory) T(forward<Args>(args)...);
+		if(!is_trivially_destructible<T>::value) {
+			Finalizer* finalizer = (Finalizer*)this->allocate(sizeof(Finalizer), alignof(Finalizer));
+			finalizer->destroy = &Arena::destroy<T>;
+			finalizer->object = object;
+			finalizer->next = this->finalizers_;
+			this->finalizers_ = finalizer;
+		}
+		return object;
+	}
+
+	/**
+	 * Returns 'size' bytes of uninitialized memory, aligned to 'alignment' (a
+	 * power of two). Requests larger than a block get a block of their own.
+	 * Blocks are only aligned for fundamental types, so throws an invalid_argument
+	 * exception if 'alignment' is larger than alignof(max_align_t).
+	 *
+	 * @param 	size 		The number of bytes needed
+	 * @param 	alignment 	The alignment needed
+	 */
+	void* allocate(size_t size, size_t alignment = alignof(max_align_t)) {
+		if(alignment > alignof(max_align_t)) {
+			throw invalid_argument("An Arena can't align memory beyond alignof(max_align_t)!");
+		}
+		if(this->block_ < this->blocks_.size()) {
+			size_t start = (this->offset_ + alignment - 1) & ~(alignment - 1);
+			if(start + size <= this->blocks_[this->block_].size) {
+				this->offset_ = start + size;
+				return this->blocks_[this->block_].memory + start;
+			}
+			//Move on to the next block
+			this->blocks_[this->block_].used = this->offset_;
+			this->block_++;
+			this->offset_ = 0;
+		}
+		//Reuse the next block if it is large enough, or insert a new one
+		if(this->block_ >= this->blocks_.size() || this->blocks_[this->block_].size < size) {
+			Block block;
+			block.size = (size > this->block_size_) ? size : this->block_size_;
+			block.memory = (char*)::operator new(block.size);
+			block.used = 0;
+			this->blocks_.insert(this->blocks_.begin() + this->block_, block);
+		}
+		//::operator new returns memory aligned for any fundamental type
+		this->offset_ = size;
+		return this->blocks_[this->block_].memory;
+	}
+
+	/* Destroys every object in the Arena and rewinds it, keeping its blocks */
+	void reset() {
+		while(this->finalizers_ != NULL) {
+			Finalizer* finalizer = this->finalizers_;
+			this->finalizers_ = finalizer->next;
+			finalizer->destroy(finalizer->object);
+		}
+		this->block_ = 0;
+		this->offset_ = 0;
+	}
+
+private:
+
+	/* A block of memory requested from the system */
+	struct Block {
+		char* memory;
+		size_t size;
+		size_t used;
+	};
+
+	/* A record of an object whose destructor must run on reset */
+	struct Finalizer {
+		void (*destroy)(void* object);
+		void* object;
+		Finalizer* next;
+	};
+
+	/*** Private member variables ***/
+
+	size_t block_size_;
+	vector<Block> blocks_;
+	unsigned int block_;
+	size_t offset_;
+	Finalizer* finalizers_;
+
+	/*** Private method implementation ***/
+
+	template<class T> static void destroy(void* object) {
+		((T*)object)->~T();
+	}
+
+};
+
+#endif
@@ -0,0 +1,274 @@
+/**
+ * @file AsyncFileBuffer.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Describes and implements the AsyncFileBuffer class, a stream buffer that writes
+ * to a file from a background thread. Output is collected in a ring of CHUNK_COUNT
+ * page-aligned chunks. The writing thread fills one chunk at a time, straight from
+ * an ostream (or with sputc()/sputn()); a full chunk is handed to the background
+ * thread, which writes it to the file with a single large write.
+ *
+ * The ring has a single producer and a single consumer, and the two threads only
+ * share a pair of atomic counters; the mutex and condition variables are used to
+ * sleep, once per chunk at most, when the ring is empty or full. A full ring makes
+ * the producer wait for the disk, so memory use is bounded by the ring's size.
+ *
+ * sync() (e.g. from flush() or endl) hands off the current chunk early, but does not
+ * wait for it to reach the file; flush() and close() do.
+ *
+ * A write that fails (e.g. on a full disk) is recorded by the background thread,
+ * which then discards the rest of the output. The stream sees the failure at its
+ * next sync() or overflow(), and flush() and close() throw it as a runtime_error
+ * on the producer's thread, so a truncated file is never mistaken for a complete one.
+ */
+
+#ifndef ASYNC_FILE_BUFFER_H
+#define ASYNC_FILE_BUFFER_H
+
+//Protected includes
+#include <atomic>
+#include <condition_variable>
+#include <cstdlib>
+#include <fstream>
+#include <mutex>
+#include <stdexcept>
+#include <streambuf>
+#include <string>
+#include <thread>
+
+using namespace std;
+
+class AsyncFileBuffer : public streambuf {
+
+public:
+
+	//Size of each chunk, and the number of chunks in the ring
+	static const int CHUNK_SIZE = 1 << 18;
+	static const int CHUNK_COUNT = 8;
+	//Chunks are aligned to the page size
+	static const int CHUNK_ALIGNMENT = 4096;
+
+	/*** Public interface implementation ***/
+
+	//Class constructors and destructor
+
+	/* AsyncFileBuffer constructor. No file is open, and no thread runs. */
+	AsyncFileBuffer() : head_(0), tail_(0), failed_(false), closing_(false), open_(false) {
+		for(int c = 0; c < CHUNK_COUNT; c++) {
+			this->chunks_[c] = (char*)aligned_alloc(CHUNK_ALIGNMENT, CHUNK_SIZE);
+			if(this->chunks_[c] == NULL) {
+				throw bad_alloc();
+			}
+			this->lengths_[c] = 0;
+		}
+	}
+
+	/* AsyncFileBuffer destructor. Writes any pending output and closes the file;
+	 * a failure can't be reported from here, so call close() first to see it.
+	 */
+	~AsyncFileBuffer() {
+		try {
+			this->close();
+		} catch(const runtime_error&) {
+			//No-op
+		}
+		for(int c = 0; c < CHUNK_COUNT; c++) {
+			free(this->chunks_[c]);
+		}
+	}
+
+	//An AsyncFileBuffer owns its thread and chunks, so it may not be copied
+	AsyncFileBuffer(const AsyncFileBuffer&) = delete;
+	AsyncFileBuffer& operator=(const AsyncFileBuffer&) = delete;
+
+	//Accessor methods
+
+	bool is_open() const {
+		return this->open_;
+	}
+
+	/* Returns whether any output has failed to reach the file */
+	bool failed() const {
+		return this->failed_.load(memory_order_acquire);
+	}
+
+	//Mutator methods
+
+	/**
+	 * Creates (or truncates) a file, and starts the thread that writes to it.
+	 * Throws a runtime_error if the file can't be opened.
+	 *
+	 * @param 	path 	The path of the file
+	 */
+	void open(const string& path) {
+		this->close();
+		this->file_.open(path.c_str(), ofstream::out | ofstream::trunc | ofstream::binary);
+		if(!this->file_.is_open()) {
+			throw runtime_error("Exception occured when opening a file for writing.\n\n");
+		}
+		this->head_ = 0;
+		this->tail_ = 0;
+		this->failed_ = false;
+		this->closing_ = false;
+		this->open_ = true;
+		this->setp(this->chunks_[0], this->chunks_[0] + CHUNK_SIZE);
+		this->writer_ = thread(&AsyncFileBuffer::drain, this);
+	}
+
+	/**
+	 * Waits for all of the output so far to reach the file. Throws a runtime_error
+	 * if any of it couldn't be written.
+	 */
+	void flush() {
+		if(!this->open_) {
+			return;
+		}
+		if(this->pptr() != this->pbase()) {
+			this->publish();
+			this->acquire();
+		}
+		unsigned int head = this->head_.load(memory_order_relaxed);
+		{
+			unique_lock<mutex> guard(this->lock_);
+			this->space_.wait(guard, [this, head] {
+				return this->tail_.load(memory_order_acquire) == head;
+			});
+		}
+		//The writing thread is idle until the next chunk is handed off
+		if(!this->failed() && !this->file_.flush()) {
+			this->failed_ = true;
+		}
+		if(this->failed()) {
+			throw runtime_error("Exception occured when writing to a file.\n\n");
+		}
+	}
+
+	/**
+	 * Writes any pending output, stops the writing thread and closes the file.
+	 * Throws a runtime_error if any of the output couldn't be written.
+	 */
+	void close() {
+		if(!this->open_) {
+			return;
+		}
+		this->publish();
+		{
+			lock_guard<mutex> guard(this->lock_);
+			this->closing_ = true;
+		}
+		this->ready_.notify_one();
+		this->writer_.join();
+		this->file_.close();
+		this->open_ = false;
+		this->setp(NULL, NULL);
+		if(this->failed() || this->file_.fail()) {
+			throw runtime_error("Exception occured when writing to a file.\n\n");
+		}
+	}
+
+protected:
+
+	/* Called when the current chunk is full: hands it off and starts the next one */
+	int_type overflow(int_type c) {
+		if(!this->open_ || this->failed()) {
+			return traits_type::eof();
+		}
+		this->publish();
+		this->acquire();
+		if(!traits_type::eq_int_type(c, traits_type::eof())) {
+			*this->pptr() = traits_type::to_char_type(c);
+			this->pbump(1);
+		}
+		return traits_type::not_eof(c);
+	}
+
+	/* Hands off the current chunk, without waiting for it to be written */
+	int sync() {
+		if(this->open_ && this->pptr() != this->pbase()) {
+			this->publish();
+			this->acquire();
+		}
+		return this->failed() ? -1 : 0;
+	}
+
+private:
+
+	/*** Private member variables ***/
+
+	char* chunks_[CHUNK_COUNT];
+	int lengths_[CHUNK_COUNT];
+	//Chunks handed off, and chunks written, since the file was opened
+	atomic<unsigned int> head_;
+	atomic<unsigned int> tail_;
+	//Set by the writing thread once a write fails
+	atomic<bool> failed_;
+	bool closing_;
+	bool open_;
+
+	mutex lock_;
+	condition_variable ready_;
+	condition_variable space_;
+	thread writer_;
+	ofstream file_;
+
+	/*** Private method implementation ***/
+
+	/* Hands the current chunk (if it holds anything) to the writing thread */
+	void publish() {
+		int length = (int)(this->pptr() - this->pbase());
+		if(length == 0) {
+			return;
+		}
+		unsigned int head = this->head_.load(memory_order_relaxed);
+		this->lengths_[head % CHUNK_COUNT] = length;
+		this->head_.store(head + 1, memory_order_release);
+		this->setp(NULL, NULL);
+		{
+			lock_guard<mutex> guard(this->lock_);
+		}
+		this->ready_.notify_one();
+	}
+
+	/* Waits for a free chunk, and makes it the current one */
+	void acquire() {
+		unsigned int head = this->head_.load(memory_order_relaxed);
+		if(head - this->tail_.load(memory_order_acquire) == CHUNK_COUNT) {
+			unique_lock<mutex> guard(this->lock_);
+			this->space_.wait(guard, [this, head] {
+				return head - this->tail_.load(memory_order_acquire) < CHUNK_COUNT;
+			});
+		}
+		char* chunk = this->chunks_[head % CHUNK_COUNT];
+		this->setp(chunk, chunk + CHUNK_SIZE);
+	}
+
+	/* Writing thread body. Writes chunks in order until the buffer is closed. */
+	void drain() {
+		while(true) {
+			unsigned int tail = this->tail_.load(memory_order_relaxed);
+			if(this->head_.load(memory_order_acquire) == tail) {
+				unique_lock<mutex> guard(this->lock_);
+				this->ready_.wait(guard, [this, tail] {
+					return this->head_.load(memory_order_acquire) != tail || this->closing_;
+				});
+				if(this->head_.load(memory_order_acquire) == tail) {
+					//Closing, and nothing left to write
+					return;
+				}
+			}
+			//Once a write has failed, the rest of the output is discarded
+			if(!this->failed() && !this->file_.write(this->chunks_[tail % CHUNK_COUNT], this->lengths_[tail % CHUNK_COUNT])) {
+				this->failed_.store(true, memory_order_release);
+			}
+			this->tail_.store(tail + 1, memory_order_release);
+			{
+				lock_guard<mutex> guard(this->lock_);
+			}
+			this->space_.notify_one();
+		}
+	}
+
+};
+
+#endif
@@ -0,0 +1,127 @@
+/**
+ * @file BatchMeans.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Describes and implements the BatchMeans class, which estimates confidence
+ * intervals for the long-run means of several quantities observed along a single,
+ * correlated run (such as the share of landings that each Property receives). The
+ * run is cut into batches, and the caller adds the mean of each batch; batches long
+ * enough to be nearly independent of one another make their means approximately
+ * normal, so the spread of the batch means gives an interval for the overall mean.
+ *
+ * Each quantity's batch means are summarized online (with Welford's method), so
+ * the memory used does not grow with the length of the run. Intervals use the
+ * normal quantile for the given confidence level, which is only reasonable once
+ * a few dozen batches have been added (see MINIMUM_BATCHES).
+ */
+
+#ifndef BATCH_MEANS_H
+#define BATCH_MEANS_H
+
+//Protected includes
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+using namespace std;
+
+class BatchMeans {
+
+public:
+
+	//Intervals are not trusted until this many batches have been added
+	static const int MINIMUM_BATCHES = 30;
+	//Normal quantile for a 95% confidence interval
+	static constexpr double Z_95 = 1.959963984540054;
+
+	/*** Public interface implementation ***/
+
+	//Class constructors and destructor
+
+	/**
+	 * BatchMeans constructor. Throws an invalid_argument exception if there is
+	 * nothing to observe.
+	 *
+	 * @param 	dimensions 	The number of quantities observed
+	 * @param 	z 			The normal quantile of the intervals' confidence level
+	 */
+	BatchMeans(int dimensions, double z = Z_95)
+	: dimensions_(dimensions), z_(z), batches_(0), mean_(dimensions, 0.0), squares_(dimensions, 0.0) {
+		if(dimensions < 1) {
+			throw invalid_argument("At least one quantity must be observed!");
+		}
+	}
+
+	//Accessor methods
+
+	int dimensions() const { return this->dimensions_; }
+	int batchCount() const { return this->batches_; }
+
+	/* Returns the mean of the dth quantity's batch means */
+	double mean(int d) const {
+		return this->mean_[d];
+	}
+
+	/* Returns the half-width of the dth quantity's confidence interval */
+	double halfWidth(int d) const {
+		if(this->batches_ < 2) {
+			return HUGE_VAL;
+		}
+		double variance = this->squares_[d] / (this->batches_ - 1);
+		return this->z_ * sqrt(variance / this->batches_);
+	}
+
+	/* Returns the largest half-width over every quantity */
+	double maximumHalfWidth() const {
+		double widest = 0;
+		for(int d = 0; d < this->dimensions_; d++) {
+			widest = fmax(widest, this->halfWidth(d));
+		}
+		return widest;
+	}
+
+	/* Returns whether every interval is trusted, and no wider than +/- half_width */
+	bool isWithin(double half_width) const {
+		return this->batches_ >= MINIMUM_BATCHES && this->maximumHalfWidth() <= half_width;
+	}
+
+	//Mutator methods
+
+	/**
+	 * Adds the means of one batch.
+	 *
+	 * @param 	means 	The batch's mean of each quantity (dimensions() values)
+	 */
+	void addBatch(const double* means) {
+		this->batches_++;
+		for(int d = 0; d < this->dimensions_; d++) {
+			double delta = means[d] - this->mean_[d];
+			this->mean_[d] += delta / this->batches_;
+			this->squares_[d] += delta * (means[d] - this->mean_[d]);
+		}
+	}
+
+	/* Forgets every batch */
+	void clear() {
+		this->batches_ = 0;
+		for(int d = 0; d < this->dimensions_; d++) {
+			this->mean_[d] = 0;
+			this->squares_[d] = 0;
+		}
+	}
+
+private:
+
+	/*** Private member variables ***/
+
+	int dimensions_;
+	double z_;
+	int batches_;
+	//Running mean and sum of squared deviations of each quantity's batch means
+	vector<double> mean_;
+	vector<double> squares_;
+
+};
+
+#endif
@@ -0,0 +1,134 @@
+/**
+ * @file Ring.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Describes the public interface and private methods of the templated Ring class.
+ * A Ring offers the same first-in-first-out interface as the Queue class, but
+ * stores its items in a fixed-capacity circular array that lives inside the Ring
+ * object itself. Pushing and popping never allocate memory; pushing onto a full
+ * Ring throws a length_error instead.
+ */
+
+#ifndef RING_H
+#define RING_H
+
+//Protected includes
+#include <iostream>
+#include <stdexcept>
+
+using namespace std;
+
+template<class T, int CAPACITY> class Ring {
+
+public:
+
+	/*** Public interface implementation ***/
+
+	//Class constructors and destructor
+
+	/* Default Ring constructor */
+	Ring() : head_(0), size_(0) { }
+
+	/* Ring destructor */
+	~Ring() { }
+
+	//Accessor methods
+
+	/* Returns the size (length) of the Ring */
+	int size() const {
+		return this->size_;
+	}
+
+	/* Returns the maximum number of items the Ring can hold */
+	int capacity() const {
+		return CAPACITY;
+	}
+
+	/**
+	 * Returns the value of the Ring item specified by the index 'n', counting
+	 * from the front. Performs basic index bounds checking. Throws a length_error
+	 * exception when called on an empty Ring.
+	 *
+	 * @param 	n 	The index of an item in the Ring
+	 */
+	T at(int n) const {
+		if(this->size_ == 0) {
+			throw length_error("The Ring is empty!");
+		} else if(n < 0 || n >= this->size_) {
+			throw length_error("The given index is out-of-bounds!");
+		} else {
+			return this->items_[(this->head_ + n) % CAPACITY];
+		}
+	}
+
+	/* Returns the value at the front of the Ring. Throws a length_error
+	 * exception when called on an empty Ring.
+	 */
+	T front() const {
+		return this->at(0);
+	}
+
+	/* Returns the value at the back of the Ring. Throws a length_error
+	 * exception when called on an empty Ring.
+	 */
+	T back() const {
+		return this->at(this->size_ - 1);
+	}
+
+	/* Prints the items in the Ring in order, front first, in the same
+	 * format as Queue::print().
+	 */
+	void print() {
+		cout << "\n[";
+		for(int i = 0; i < this->size_; i++) {
+			cout << this->at(i);
+			if(i != (this->size_ - 1)) {
+				cout << ", ";
+			}
+		}
+		cout << "]\n";
+	}
+
+	//Mutator methods
+
+	/**
+	 * Places a new value at the end of the Ring. Throws a length_error
+	 * when called on a full Ring.
+	 *
+	 * @param  	value 	A value of type T
+	 */
+	void push(T value) {
+		if(this->size_ == CAPACITY) {
+			throw length_error("The Ring is full!");
+		}
+		this->items_[(this->head_ + this->size_) % CAPACITY] = value;
+		this->size_++;
+	}
+
+	/* Removes the item at the front of the Ring. Throws a length_error
+	 * when called on an empty Ring.
+	 */
+	void pop() {
+		if(this->size_ == 0) {
+			throw length_error("The Ring is empty!");
+		}
+		this->head_ = (this->head_ + 1) % CAPACITY;
+		this->size_--;
+	}
+
+	/* Removes every item from the Ring */
+	void clear() {
+		this->head_ = 0;
+		this->size_ = 0;
+	}
+
+private:
+
+	T items_[CAPACITY];
+	int head_;
+	int size_;
+
+};
+
+#endif
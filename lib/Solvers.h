@@ -0,0 +1,159 @@
+/**
+ * @file Solvers.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Implements two iterative solvers for large, sparse problems. Neither needs the
+ * matrix itself, only a way to apply it: an Operator is anything that can be called
+ * as apply(const double* x, double* y) to compute y = Ax (a SparseMatrix product,
+ * or a product followed by a few adjustments).
+ *
+ * 		powerIteration 	Finds the dominant eigenvector of A, e.g. the stationary
+ * 						distribution of a Markov chain when A is the transposed
+ * 						transition matrix; simple and robust, but slow to converge
+ * 						when the chain mixes slowly
+ * 		bicgstab 		Solves Ax = b for a general (non-symmetric) A with the
+ * 						stabilized bi-conjugate gradient method; usually needs far
+ * 						fewer products than power iteration, but may break down
+ *
+ * Both stop on a residual: once the change made by one more product (power
+ * iteration), or the norm of b - Ax relative to that of b (BiCGSTAB), falls below
+ * the given tolerance.
+ */
+
+#ifndef SOLVERS_H
+#define SOLVERS_H
+
+//Protected includes
+#include <cmath>
+#include <vector>
+
+using namespace std;
+
+namespace Solvers {
+
+	/* How a solve ended */
+	struct Result {
+		bool converged;
+		int iterations;
+		double residual;
+	};
+
+	inline double dot(const vector<double>& a, const vector<double>& b) {
+		double sum = 0;
+		for(unsigned int i = 0; i < a.size(); i++) {
+			sum += a[i] * b[i];
+		}
+		return sum;
+	}
+
+	/**
+	 * Repeatedly replaces x with Ax, scaled so that its elements sum to 1, until
+	 * a product changes x by less than the tolerance (in the 1-norm).
+	 *
+	 * @param 	apply 				The Operator
+	 * @param 	x 					The starting vector; set to the solution
+	 * @param 	tolerance 			The largest change left at convergence
+	 * @param 	maximum_iterations 	The number of products to give up after
+	 */
+	template<class Operator> Result powerIteration(const Operator& apply, vector<double>& x,
+		double tolerance, int maximum_iterations) {
+		vector<double> y(x.size());
+		Result result = { false, 0, 0 };
+		while(result.iterations < maximum_iterations) {
+			apply(x.data(), y.data());
+			result.iterations++;
+			double total = 0;
+			for(unsigned int i = 0; i < y.size(); i++) {
+				total += y[i];
+			}
+			result.residual = 0;
+			for(unsigned int i = 0; i < y.size(); i++) {
+				y[i] /= total;
+				result.residual += fabs(y[i] - x[i]);
+			}
+			x.swap(y);
+			if(result.residual < tolerance) {
+				result.converged = true;
+				break;
+			}
+		}
+		return result;
+	}
+
+	/**
+	 * Solves Ax = b with BiCGSTAB, until the norm of b - Ax is at most the tolerance
+	 * times the norm of b. The solve stops early (and is not converged) if the
+	 * method breaks down.
+	 *
+	 * @param 	apply 				The Operator
+	 * @param 	b 					The right-hand side
+	 * @param 	x 					The starting guess; set to the solution
+	 * @param 	tolerance 			The largest relative residual left at convergence
+	 * @param 	maximum_iterations 	The number of iterations to give up after
+	 */
+	template<class Operator> Result bicgstab(const Operator& apply, const vector<double>& b, vector<double>& x,
+		double tolerance, int maximum_iterations) {
+		int n = (int)b.size();
+		vector<double> r(n), r0(n), p(n, 0.0), v(n, 0.0), s(n), t(n);
+		Result result = { false, 0, 0 };
+		apply(x.data(), r.data());
+		for(int i = 0; i < n; i++) {
+			r[i] = b[i] - r[i];
+		}
+		r0 = r;
+		double bound = tolerance * sqrt(dot(b, b));
+		result.residual = sqrt(dot(r, r));
+		if(result.residual <= bound) {
+			result.converged = true;
+			return result;
+		}
+		double rho = 1, alpha = 1, omega = 1;
+		while(result.iterations < maximum_iterations) {
+			result.iterations++;
+			double next_rho = dot(r0, r);
+			if(next_rho == 0 || omega == 0) {
+				//Breakdown
+				break;
+			}
+			double beta = (next_rho / rho) * (alpha / omega);
+			rho = next_rho;
+			for(int i = 0; i < n; i++) {
+				p[i] = r[i] + beta * (p[i] - omega * v[i]);
+			}
+			apply(p.data(), v.data());
+			double r0v = dot(r0, v);
+			if(r0v == 0) {
+				break;
+			}
+			alpha = rho / r0v;
+			for(int i = 0; i < n; i++) {
+				s[i] = r[i] - alpha * v[i];
+			}
+			if(sqrt(dot(s, s)) <= bound) {
+				for(int i = 0; i < n; i++) {
+					x[i] += alpha * p[i];
+				}
+				result.residual = sqrt(dot(s, s));
+				result.converged = true;
+				break;
+			}
+			apply(s.data(), t.data());
+			double tt = dot(t, t);
+			omega = (tt == 0) ? 0 : dot(t, s) / tt;
+			for(int i = 0; i < n; i++) {
+				x[i] += alpha * p[i] + omega * s[i];
+				r[i] = s[i] - omega * t[i];
+			}
+			result.residual = sqrt(dot(r, r));
+			if(result.residual <= bound) {
+				result.converged = true;
+				break;
+			}
+		}
+		return result;
+	}
+
+};
+
+#endif
@@ -0,0 +1,194 @@
+/**
+ * @file SparseMatrix.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Describes and implements the SparseMatrix class, a matrix stored in compressed
+ * sparse row (CSR) form: the non-zero values of every row, one row after another,
+ * with their column indices, and the offset at which each row starts. A matrix is
+ * built once from a list of entries (in any order, with duplicates summed) and is
+ * then only read.
+ *
+ * A matrix-vector product gathers each row's values into its own output element,
+ * so rows may be split between threads without any locking. Products with at least
+ * PARALLEL_NON_ZEROS non-zeros are spread across the threads of a ThreadPool that
+ * the caller keeps (e.g. for a whole solve), each taking a contiguous range of rows
+ * holding about the same number of non-zeros; smaller products run on the calling
+ * thread, where waking the pool would cost more than the product itself.
+ */
+
+#ifndef SPARSE_MATRIX_H
+#define SPARSE_MATRIX_H
+
+//Protected includes
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+#include "ThreadPool.h"
+
+using namespace std;
+
+class SparseMatrix {
+
+public:
+
+	//Products with fewer non-zeros than this run on the calling thread only
+	static const int PARALLEL_NON_ZEROS = 1 << 16;
+
+	/* A single (row, column, value) entry, used to build a matrix */
+	struct Entry {
+		int row;
+		int column;
+		double value;
+	};
+
+	/*** Public interface implementation ***/
+
+	//Class constructors and destructor
+
+	/* SparseMatrix constructor. Creates an empty 0x0 matrix. */
+	SparseMatrix() : rows_(0), columns_(0), offsets_(1, 0) { }
+
+	/**
+	 * SparseMatrix constructor. Builds a matrix from its entries, which may be in
+	 * any order; entries at the same position are summed. Throws an out_of_range
+	 * exception if an entry lies outside of the matrix.
+	 *
+	 * @param 	rows 		The number of rows
+	 * @param 	columns 	The number of columns
+	 * @param 	entries 	The matrix's non-zero entries
+	 */
+	SparseMatrix(int rows, int columns, const vector<Entry>& entries)
+	: rows_(rows), columns_(columns), offsets_(rows + 1, 0) {
+		//Count each row's entries, then place them with a counting sort
+		for(unsigned int e = 0; e < entries.size(); e++) {
+			if(entries[e].row < 0 || entries[e].row >= rows || entries[e].column < 0 || entries[e].column >= columns) {
+				throw out_of_range("A matrix entry lies outside of the matrix!");
+			}
+			this->offsets_[entries[e].row + 1]++;
+		}
+		for(int r = 0; r < rows; r++) {
+			this->offsets_[r + 1] += this->offsets_[r];
+		}
+		vector<int> next(this->offsets_.begin(), this->offsets_.end() - 1);
+		vector<pair<int, double> > placed(entries.size());
+		for(unsigned int e = 0; e < entries.size(); e++) {
+			placed[next[entries[e].row]++] = make_pair(entries[e].column, entries[e].value);
+		}
+		//Order each row by column, and merge duplicate columns
+		int size = 0;
+		for(int r = 0; r < rows; r++) {
+			int first = this->offsets_[r];
+			int last = this->offsets_[r + 1];
+			sort(placed.begin() + first, placed.begin() + last,
+				[](const pair<int, double>& a, const pair<int, double>& b) { return a.first < b.first; });
+			this->offsets_[r] = size;
+			for(int e = first; e < last; e++) {
+				if(e > first && placed[e].first == this->column_indices_.back()) {
+					this->values_.back() += placed[e].second;
+				} else {
+					this->column_indices_.push_back(placed[e].first);
+					this->values_.push_back(placed[e].second);
+					size++;
+				}
+			}
+		}
+		this->offsets_[rows] = size;
+	}
+
+	//Accessor methods
+
+	int rows() const { return this->rows_; }
+	int columns() const { return this->columns_; }
+	int nonZeros() const { return (int)this->values_.size(); }
+
+	/* Returns the value at a position (zero if nothing is stored there) */
+	double at(int row, int column) const {
+		for(int e = this->offsets_[row]; e < this->offsets_[row + 1]; e++) {
+			if(this->column_indices_[e] == column) {
+				return this->values_[e];
+			}
+		}
+		return 0;
+	}
+
+	/**
+	 * Computes y = Ax on the calling thread. x must hold columns() elements and y
+	 * rows() elements, and the two may not overlap.
+	 *
+	 * @param 	x 	The vector to multiply
+	 * @param 	y 	Set to the product
+	 */
+	void multiply(const double* x, double* y) const {
+		this->multiplyRows(x, y, 0, this->rows_);
+	}
+
+	/**
+	 * Computes y = Ax, spreading a large product across a pool's threads. x must
+	 * hold columns() elements and y rows() elements, and the two may not overlap.
+	 *
+	 * @param 	x 		The vector to multiply
+	 * @param 	y 		Set to the product
+	 * @param 	pool 	The threads to spread a large product across
+	 */
+	void multiply(const double* x, double* y, ThreadPool& pool) const {
+		int thread_count = pool.threadCount();
+		if(thread_count <= 1 || this->nonZeros() < PARALLEL_NON_ZEROS) {
+			this->multiplyRows(x, y, 0, this->rows_);
+			return;
+		}
+		//Cut the rows into ranges holding about the same number of non-zeros
+		vector<int> bounds(thread_count + 1, this->rows_);
+		bounds[0] = 0;
+		for(int t = 1; t < thread_count; t++) {
+			long long target = (long long)this->nonZeros() * t / thread_count;
+			bounds[t] = (int)(lower_bound(this->offsets_.begin(), this->offsets_.end(), target) - this->offsets_.begin());
+			bounds[t] = min(max(bounds[t], bounds[t - 1]), this->rows_);
+		}
+		//Each worker (the calling thread first) takes one range
+		pool.run([this, x, y, &bounds](int worker) {
+			this->multiplyRows(x, y, bounds[worker], bounds[worker + 1]);
+		});
+	}
+
+private:
+
+	/*** Private member variables ***/
+
+	int rows_;
+	int columns_;
+	//Row r's entries lie in [offsets_[r], offsets_[r + 1])
+	vector<int> offsets_;
+	vector<int> column_indices_;
+	vector<double> values_;
+
+	/*** Private method implementation ***/
+
+	/**
+	 * Computes the rows [first, last) of y = Ax. Each row is summed into four
+	 * independent partial sums, so that consecutive gathers and multiplies need
+	 * not wait for one another.
+	 */
+	void multiplyRows(const double* x, double* y, int first, int last) const {
+		const int* columns = this->column_indices_.data();
+		const double* values = this->values_.data();
+		for(int r = first; r < last; r++) {
+			int e = this->offsets_[r];
+			int end = this->offsets_[r + 1];
+			double sum0 = 0, sum1 = 0, sum2 = 0, sum3 = 0;
+			for(; e + 4 <= end; e += 4) {
+				sum0 += values[e] * x[columns[e]];
+				sum1 += values[e + 1] * x[columns[e + 1]];
+				sum2 += values[e + 2] * x[columns[e + 2]];
+				sum3 += values[e + 3] * x[columns[e + 3]];
+			}
+			for(; e < end; e++) {
+				sum0 += values[e] * x[columns[e]];
+			}
+			y[r] = (sum0 + sum1) + (sum2 + sum3);
+		}
+	}
+
+};
+
+#endif
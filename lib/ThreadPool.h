@@ -0,0 +1,161 @@
+/**
+ * @file ThreadPool.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Describes and implements the ThreadPool class, a fixed set of worker threads
+ * that are started once and then run many short tasks, such as the matrix-vector
+ * products of an iterative solve. run() hands the same task to every worker, and
+ * returns once they have all finished it; the calling thread doubles as the first
+ * worker, so a pool of N threads starts only N - 1 of its own.
+ *
+ * Between tasks, the workers sleep on a condition variable, so a pool costs
+ * nothing while it is idle, and a task costs a wake-up rather than a thread's
+ * start and join. An exception thrown by the task on any worker is rethrown by
+ * run() on the calling thread (the first one thrown, if several are).
+ */
+
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+//Protected includes
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+class ThreadPool {
+
+public:
+
+	/*** Public interface implementation ***/
+
+	//Class constructors and destructor
+
+	/**
+	 * ThreadPool constructor. Starts the pool's workers, less the calling thread.
+	 *
+	 * @param 	thread_count 	The number of threads to run each task on (at least 1)
+	 */
+	ThreadPool(int thread_count)
+	: thread_count_(thread_count < 1 ? 1 : thread_count), task_(NULL), generation_(0), running_(0), stopping_(false) {
+		for(int w = 1; w < this->thread_count_; w++) {
+			this->threads_.push_back(thread(&ThreadPool::work, this, w));
+		}
+	}
+
+	/* ThreadPool destructor. Stops and joins the pool's workers. */
+	~ThreadPool() {
+		{
+			lock_guard<mutex> guard(this->lock_);
+			this->stopping_ = true;
+		}
+		this->wake_.notify_all();
+		for(unsigned int t = 0; t < this->threads_.size(); t++) {
+			this->threads_[t].join();
+		}
+	}
+
+	//A pool owns its threads, so it can't be copied
+	ThreadPool(const ThreadPool& other) = delete;
+	ThreadPool& operator=(const ThreadPool& other) = delete;
+
+	//Accessor methods
+
+	int threadCount() const { return this->thread_count_; }
+
+	/**
+	 * Calls task(w) once on every worker w in [0, threadCount()), with worker 0
+	 * being the calling thread, and returns once every call has returned.
+	 *
+	 * @param 	task 	The function to call on every worker
+	 */
+	void run(const function<void(int)>& task) {
+		if(this->thread_count_ == 1) {
+			task(0);
+			return;
+		}
+		{
+			lock_guard<mutex> guard(this->lock_);
+			this->task_ = &task;
+			this->running_ = this->thread_count_ - 1;
+			this->error_ = nullptr;
+			this->generation_++;
+		}
+		this->wake_.notify_all();
+		exception_ptr error;
+		try {
+			task(0);
+		} catch(...) {
+			error = current_exception();
+		}
+		unique_lock<mutex> guard(this->lock_);
+		this->done_.wait(guard, [this]() { return this->running_ == 0; });
+		this->task_ = NULL;
+		if(!error) {
+			error = this->error_;
+		}
+		guard.unlock();
+		if(error) {
+			rethrow_exception(error);
+		}
+	}
+
+private:
+
+	/*** Private member variables ***/
+
+	int thread_count_;
+	vector<thread> threads_;
+	mutex lock_;
+	//Signals the workers that a task (or the end of the pool) has come
+	condition_variable wake_;
+	//Signals run() that the last worker has finished the task
+	condition_variable done_;
+	const function<void(int)>* task_;
+	//Counts the tasks run, so that a worker runs each one once
+	unsigned long long generation_;
+	int running_;
+	bool stopping_;
+	//The first exception thrown by a worker other than the calling thread
+	exception_ptr error_;
+
+	/*** Private method implementation ***/
+
+	/* Worker thread body. Runs each new task until the pool is destroyed. */
+	void work(int worker) {
+		unsigned long long generation = 0;
+		while(true) {
+			const function<void(int)>* task;
+			{
+				unique_lock<mutex> guard(this->lock_);
+				this->wake_.wait(guard, [this, generation]() { return this->stopping_ || this->generation_ != generation; });
+				if(this->stopping_) {
+					return;
+				}
+				generation = this->generation_;
+				task = this->task_;
+			}
+			exception_ptr error;
+			try {
+				(*task)(worker);
+			} catch(...) {
+				error = current_exception();
+			}
+			lock_guard<mutex> guard(this->lock_);
+			if(error && !this->error_) {
+				this->error_ = error;
+			}
+			if(--this->running_ == 0) {
+				this->done_.notify_one();
+			}
+		}
+	}
+
+};
+
+#endif
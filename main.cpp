@@ -11,6 +11,16 @@
  *  	3. The initial random seed  					[OPTIONAL]
  *  	4. Flag for 'verbose mode' 						[OPTIONAL]
  *
+ * Passing '--games N' simulates N independent games with the BatchSimulator,
+ * spread across '--threads T' worker threads. Passing '--markov' (with a single
+ * player and '--shuffle none') computes the exact long-run landing probabilities
+ * with the MarkovSolver instead, and passing any of the '--sweep-*' options plays
+ * a whole grid of configurations with the SweepRunner. Each of them plays on the
+ * board given by '--board PATH' (see 'boards/'), or on the classic board by
+ * default, and shuffles each game's decks as '--shuffle WHEN' says (at the start
+ * of the game, by default); a sweep may also range over '--sweep-boards' and
+ * '--sweep-shuffle'.
+ *
  * These arguments are passed into the SimulatorConfig object and used by
  * the Simulator to configure specific simulations.
  */
@@ -18,14 +28,34 @@
 //Class dependencies
 #include "SimulatorConfig.h"
 #include "Simulator.h"
+#include "MonteCarloRunner.h"
+#include "MarkovSolver.h"
+#include "SweepRunner.h"
 
 using namespace std;
 
 int main(int argc, char *argv[]) {
 
 	//Attempt to instantiate a config object describing how our simulation should run
-	Simulator s((SimulatorConfig(argc, argv)));
-	s.runSimulation();
+	SimulatorConfig config(argc, argv);
+	if(config.isMarkov()) {
+		//Compute the long-run landing probabilities without playing any games
+		MarkovSolver m(config);
+		m.runSimulation();
+	} else
+	if(config.isSwept()) {
+		//Play every point of the sweep in this one process
+		SweepRunner w(config);
+		w.runSimulation();
+	} else
+	if(config.gameCount() > 1) {
+		//Play many independent games in lockstep, on every available core
+		MonteCarloRunner r(config);
+		r.runSimulation();
+	} else {
+		Simulator s(config);
+		s.runSimulation();
+	}
 
 	return EXIT_SUCCESS;
 
@@ -0,0 +1,189 @@
+/**
+ * @file monopoly.cpp
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Contains implementation of the simulator's C library interface. Every entry
+ * point catches the exceptions thrown by the simulator's classes, and turns them
+ * into a monopoly_status and a message for monopoly_last_error(). For details about
+ * the interface, see 'monopoly.h'.
+ */
+
+//Protected includes
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+//Interface header include
+#include "monopoly.h"
+
+//Class dependencies
+#include "SimulatorConfig.h"
+#include "Board.h"
+#include "BoardDefinition.h"
+#include "BatchSimulator.h"
+#include "MonteCarloRunner.h"
+
+using namespace std;
+
+static_assert(MONOPOLY_BOARD_SIZE == Board::BOARD_SIZE, "The interface's board size must match the Board's");
+static_assert(MONOPOLY_MAXIMUM_BOARD_SIZE == Board::MAXIMUM_SIZE, "The interface's largest board must match the Board's");
+
+//Configurations from callers built against version 1 end after 'thread_count'
+static const size_t VERSION_1_CONFIG_SIZE = offsetof(monopoly_config, board_path);
+
+/* A simulation: its configuration, callback, and the counts of its last run */
+struct monopoly_simulation {
+	SimulatorConfig config;
+	monopoly_round_callback callback;
+	void* user_data;
+	unsigned long long counts[Board::MAXIMUM_SIZE];
+};
+
+//The calling thread's most recent failure
+static thread_local string last_error;
+
+/* Records a failure, and returns its status */
+static monopoly_status fail(monopoly_status status, const string& message) {
+	last_error = message;
+	return status;
+}
+
+/* Builds a SimulatorConfig from a configuration struct, reading only the fields that its size covers */
+static SimulatorConfig toSimulatorConfig(const monopoly_config* config) {
+	if(config == NULL || config->size < VERSION_1_CONFIG_SIZE) {
+		throw invalid_argument("The configuration was not initialized with monopoly_config_init()!");
+	}
+	bool has_board = config->size >= sizeof(monopoly_config) && config->board_path != NULL;
+	return SimulatorConfig(config->player_count, config->turn_count, config->has_seed != 0, config->seed,
+						   config->game_count, config->first_game, config->thread_count,
+						   has_board ? config->board_path : "");
+}
+
+/* Calls a function, turning any exception it throws into a status */
+template<class Function> static monopoly_status guard(Function function) {
+	try {
+		function();
+	} catch(const invalid_argument& e) {
+		return fail(MONOPOLY_INVALID_ARGUMENT, e.what());
+	} catch(const exception& e) {
+		return fail(MONOPOLY_RUNTIME_ERROR, e.what());
+	} catch(...) {
+		return fail(MONOPOLY_RUNTIME_ERROR, "Unknown error!");
+	}
+	return MONOPOLY_OK;
+}
+
+int monopoly_api_version(void) {
+	return MONOPOLY_API_VERSION;
+}
+
+void monopoly_config_init(monopoly_config* config) {
+	if(config == NULL) {
+		return;
+	}
+	memset(config, 0, sizeof(monopoly_config));
+	config->size = sizeof(monopoly_config);
+	config->player_count = 2;
+	config->game_count = 1;
+}
+
+monopoly_status monopoly_create(const monopoly_config* config, monopoly_simulation** simulation) {
+	if(simulation == NULL) {
+		return fail(MONOPOLY_INVALID_ARGUMENT, "No simulation pointer was given!");
+	}
+	*simulation = NULL;
+	return guard([&]() {
+		monopoly_simulation* created = new monopoly_simulation{ toSimulatorConfig(config), NULL, NULL, { 0 } };
+		*simulation = created;
+	});
+}
+
+monopoly_status monopoly_configure(monopoly_simulation* simulation, const monopoly_config* config) {
+	if(simulation == NULL) {
+		return fail(MONOPOLY_INVALID_ARGUMENT, "No simulation was given!");
+	}
+	return guard([&]() {
+		simulation->config = toSimulatorConfig(config);
+		for(int i = 0; i < Board::MAXIMUM_SIZE; i++) {
+			simulation->counts[i] = 0;
+		}
+	});
+}
+
+monopoly_status monopoly_set_round_callback(monopoly_simulation* simulation,
+	monopoly_round_callback callback, void* user_data) {
+	if(simulation == NULL) {
+		return fail(MONOPOLY_INVALID_ARGUMENT, "No simulation was given!");
+	}
+	simulation->callback = callback;
+	simulation->user_data = user_data;
+	return MONOPOLY_OK;
+}
+
+monopoly_status monopoly_run(monopoly_simulation* simulation) {
+	if(simulation == NULL) {
+		return fail(MONOPOLY_INVALID_ARGUMENT, "No simulation was given!");
+	}
+	return guard([&]() {
+		const SimulatorConfig& config = simulation->config;
+		int size = config.board()->size();
+		if(simulation->callback != NULL || config.gameCount() <= BatchSimulator::LANES) {
+			//A single block of games (or a callback) runs on the calling thread
+			BatchSimulator batch(config);
+			batch.setRoundCallback(simulation->callback, simulation->user_data);
+			batch.simulateGames(config.firstGame(), config.gameCount());
+			for(int i = 0; i < size; i++) {
+				simulation->counts[i] = batch.landingCount(i);
+			}
+		} else {
+			MonteCarloRunner runner(config);
+			runner.simulateGames(config.firstGame(), config.gameCount());
+			for(int i = 0; i < size; i++) {
+				simulation->counts[i] = runner.landingCount(i);
+			}
+		}
+	});
+}
+
+monopoly_status monopoly_collect(const monopoly_simulation* simulation, unsigned long long* counts, int size) {
+	if(simulation == NULL || counts == NULL) {
+		return fail(MONOPOLY_INVALID_ARGUMENT, "No simulation or buffer was given!");
+	}
+	int board_size = simulation->config.board()->size();
+	if(size < board_size) {
+		return fail(MONOPOLY_INVALID_ARGUMENT, "The buffer is too small to hold every landing count!");
+	}
+	memcpy(counts, simulation->counts, board_size * sizeof(unsigned long long));
+	return MONOPOLY_OK;
+}
+
+int monopoly_board_size(const monopoly_simulation* simulation) {
+	return (simulation == NULL) ? 0 : simulation->config.board()->size();
+}
+
+const char* monopoly_tile_name(const monopoly_simulation* simulation, int index) {
+	if(simulation == NULL || index < 0 || index >= simulation->config.board()->size()) {
+		return NULL;
+	}
+	//The name belongs to the configuration's definition, which is kept until the next monopoly_configure()
+	return simulation->config.board()->tileName(index);
+}
+
+const char* monopoly_property_name(int index) {
+	if(index < 0 || index >= Board::BOARD_SIZE) {
+		return NULL;
+	}
+	//The classic definition is built once, on first use, and lives as long as the program
+	return BoardDefinition::classic()->tileName(index);
+}
+
+const char* monopoly_last_error(void) {
+	return last_error.c_str();
+}
+
+void monopoly_destroy(monopoly_simulation* simulation) {
+	delete simulation;
+}
@@ -0,0 +1,126 @@
+/**
+ * @file monopoly.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * The simulator's library interface, for programs that would rather call the
+ * simulator in-process than run 'a.out' and parse its output files. 'make library'
+ * builds it as a static (libmonopoly.a) and a shared (libmonopoly.so) library.
+ *
+ * The interface is plain C, so that it can be called from C and from any language
+ * with a C foreign-function interface, and its ABI stays stable as the simulator
+ * changes: simulations are opaque handles, configurations are plain structs that
+ * begin with their own size (so that fields may later be added at the end), and no
+ * exception or C++ type ever crosses it. A simulation is configured with a struct,
+ * run, and its landing counts are then copied into a buffer that the caller
+ * provides; nothing is written to disk.
+ *
+ * 		monopoly_simulation* simulation;
+ * 		monopoly_config config;
+ * 		unsigned long long counts[MONOPOLY_BOARD_SIZE];
+ * 		monopoly_config_init(&config);
+ * 		config.player_count = 4;
+ * 		config.turn_count = 10000;
+ * 		if(monopoly_create(&config, &simulation) == MONOPOLY_OK) {
+ * 			monopoly_run(simulation);
+ * 			monopoly_collect(simulation, counts, MONOPOLY_BOARD_SIZE);
+ * 			monopoly_destroy(simulation);
+ * 		}
+ *
+ * Games are played on the classic board unless the configuration names a board
+ * definition file (see 'BoardDefinition.h'); monopoly_board_size() and
+ * monopoly_tile_name() then describe the simulation's board, and buffers must
+ * hold its landing counts (at most MONOPOLY_MAXIMUM_BOARD_SIZE of them).
+ *
+ * Games are played by the BatchSimulator (spread across threads by the
+ * MonteCarloRunner when there are many), so a given seed and game produce exactly
+ * the counts that the command-line program reports for them. A round callback, if
+ * one is set, is called on the calling thread after every round with the totals so
+ * far; runs with a callback therefore play all of their games on that thread.
+ *
+ * Every call that can fail returns a monopoly_status; monopoly_last_error()
+ * describes the calling thread's most recent failure. Different simulations may be
+ * used from different threads at once, but a single simulation may not.
+ */
+
+#ifndef MONOPOLY_H
+#define MONOPOLY_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//Incremented whenever the interface changes
+#define MONOPOLY_API_VERSION 2
+
+//The number of Properties on the classic board, and the most that any board may hold
+#define MONOPOLY_BOARD_SIZE 40
+#define MONOPOLY_MAXIMUM_BOARD_SIZE 64
+
+typedef enum monopoly_status {
+	MONOPOLY_OK = 0,
+	MONOPOLY_INVALID_ARGUMENT = 1,
+	MONOPOLY_RUNTIME_ERROR = 2
+} monopoly_status;
+
+/* The configuration of a simulation; fill it in after monopoly_config_init() */
+typedef struct monopoly_config {
+	unsigned int size; 			//sizeof(monopoly_config), set by monopoly_config_init()
+	int player_count; 			//2—6 (default 2)
+	int turn_count; 			//Turns allowed for each player (default 0)
+	int has_seed; 				//Non-zero if 'seed' is used (default 0: seed from the time)
+	int seed; 					//The initial random seed
+	int game_count; 			//Independent games to play (default 1)
+	int first_game; 			//Index of the first game in the seed's sequence (default 0)
+	int thread_count; 			//Worker threads, or 0 to use every core (default 0)
+	const char* board_path; 	//A board definition file, or NULL for the classic board (default NULL; since version 2)
+} monopoly_config;
+
+/* An opaque simulation */
+typedef struct monopoly_simulation monopoly_simulation;
+
+/* Called after every round with the round's index, the landing totals so far, and the caller's data */
+typedef void (*monopoly_round_callback)(int round, const unsigned long long* counts, void* user_data);
+
+/* Returns the MONOPOLY_API_VERSION that the library was built with */
+int monopoly_api_version(void);
+
+/* Fills a configuration in with its size and default values */
+void monopoly_config_init(monopoly_config* config);
+
+/* Creates a simulation; on success, *simulation must later be passed to monopoly_destroy() */
+monopoly_status monopoly_create(const monopoly_config* config, monopoly_simulation** simulation);
+
+/* Replaces a simulation's configuration, and clears its counts */
+monopoly_status monopoly_configure(monopoly_simulation* simulation, const monopoly_config* config);
+
+/* Sets the function called after every round (or clears it, given NULL) */
+monopoly_status monopoly_set_round_callback(monopoly_simulation* simulation,
+	monopoly_round_callback callback, void* user_data);
+
+/* Plays the configured games, replacing the counts of any earlier run */
+monopoly_status monopoly_run(monopoly_simulation* simulation);
+
+/* Copies the landing counts of the last run into counts[0, size), size being at least the simulation's board size */
+monopoly_status monopoly_collect(const monopoly_simulation* simulation, unsigned long long* counts, int size);
+
+/* Returns the number of Properties on a simulation's board (0 if given NULL) */
+int monopoly_board_size(const monopoly_simulation* simulation);
+
+/* Returns the name of the Property at an index of a simulation's board (until it is reconfigured), or NULL */
+const char* monopoly_tile_name(const monopoly_simulation* simulation, int index);
+
+/* Returns the name of the Property at an index of the classic board, or NULL if there is none */
+const char* monopoly_property_name(int index);
+
+/* Describes the calling thread's most recent failure (an empty string if there was none) */
+const char* monopoly_last_error(void);
+
+/* Destroys a simulation (NULL is ignored) */
+void monopoly_destroy(monopoly_simulation* simulation);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
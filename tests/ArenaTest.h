@@ -0,0 +1,115 @@
+/**
+ * @file ArenaTest.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Contains unit tests for the Arena class.
+ */
+
+#ifndef ARENA_TEST_H
+#define ARENA_TEST_H
+
+//Protected includes
+#include <cstdint>
+#include <string>
+#include <stdexcept>
+#include <cxxtest/TestSuite.h>
+
+//Class header include
+#include "../lib/Arena.h"
+
+using namespace std;
+
+/* Counts its own destructions, so that tests can tell when the Arena runs them */
+class Tracked {
+
+public:
+
+	Tracked(int& destroyed) : destroyed_(destroyed) { }
+	~Tracked() { this->destroyed_++; }
+
+private:
+
+	int& destroyed_;
+
+};
+
+class ArenaTest : public CxxTest::TestSuite {
+
+public:
+
+	/* Constructor Tests */
+
+	void testDefaultConstructor() {
+		Arena a;
+		TS_ASSERT_EQUALS(a.blockCount(), 0);
+		TS_ASSERT_EQUALS(a.bytesUsed(), 0u);
+		TS_ASSERT_THROWS(Arena(0), invalid_argument);
+	}
+
+	/* Mutator Tests */
+
+	void testCreate() {
+		Arena a;
+		string* s = a.create<string>("Boardwalk");
+		int* n = a.create<int>(42);
+		TS_ASSERT_EQUALS(*s, "Boardwalk");
+		TS_ASSERT_EQUALS(*n, 42);
+		TS_ASSERT_EQUALS((uintptr_t)n % alignof(int), 0u);
+		TS_ASSERT_EQUALS(a.blockCount(), 1);
+	}
+
+	void testAllocateSpansBlocks() {
+		Arena a(64);
+		for(int i = 0; i < 16; i++) {
+			a.allocate(16, 8);
+		}
+		TS_ASSERT_EQUALS(a.blockCount(), 4);
+		TS_ASSERT_EQUALS(a.bytesUsed(), 256u);
+		//Oversized requests get a block of their own
+		a.allocate(1000);
+		TS_ASSERT_EQUALS(a.blockCount(), 5);
+		//Blocks can't honour alignments beyond those of the fundamental types
+		TS_ASSERT_THROWS(a.allocate(16, 2 * alignof(max_align_t)), invalid_argument);
+		TS_ASSERT_EQUALS(a.blockCount(), 5);
+	}
+
+	void testResetDestroysObjects() {
+		int destroyed = 0;
+		Arena a;
+		a.create<Tracked>(destroyed);
+		a.create<Tracked>(destroyed);
+		TS_ASSERT_EQUALS(destroyed, 0);
+		a.reset();
+		TS_ASSERT_EQUALS(destroyed, 2);
+		TS_ASSERT_EQUALS(a.bytesUsed(), 0u);
+		//Destroying the Arena doesn't destroy the objects a second time
+		a.create<Tracked>(destroyed);
+	}
+
+	void testResetKeepsBlocks() {
+		Arena a(64);
+		for(int i = 0; i < 16; i++) {
+			a.allocate(16, 8);
+		}
+		a.reset();
+		for(int i = 0; i < 16; i++) {
+			a.allocate(16, 8);
+		}
+		TS_ASSERT_EQUALS(a.blockCount(), 4);
+	}
+
+	void testDestructorDestroysObjects() {
+		int destroyed = 0;
+		{
+			Arena a;
+			a.create<Tracked>(destroyed);
+			a.create<Tracked>(destroyed);
+			a.create<Tracked>(destroyed);
+		}
+		TS_ASSERT_EQUALS(destroyed, 3);
+	}
+
+};
+
+#endif
@@ -0,0 +1,111 @@
+/**
+ * @file AsyncFileBufferTest.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Contains unit tests for the AsyncFileBuffer class.
+ */
+
+#ifndef ASYNC_FILE_BUFFER_TEST_H
+#define ASYNC_FILE_BUFFER_TEST_H
+
+//Protected includes
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <stdexcept>
+#include <cxxtest/TestSuite.h>
+
+//Class header include
+#include "../lib/AsyncFileBuffer.h"
+
+using namespace std;
+
+class AsyncFileBufferTest : public CxxTest::TestSuite {
+
+public:
+
+	void testWrite() {
+		AsyncFileBuffer buffer;
+		TS_ASSERT(!buffer.is_open());
+		buffer.open(FILE_PATH);
+		TS_ASSERT(buffer.is_open());
+		ostream output(&buffer);
+		output << "Num Players: " << 3 << "\n";
+		buffer.close();
+		TS_ASSERT(!buffer.is_open());
+		TS_ASSERT_EQUALS(this->readFile(), "Num Players: 3\n");
+		remove(FILE_PATH);
+	}
+
+	void testWriteMoreThanTheRing() {
+		//Enough output to wrap around the ring several times, with flushes in between
+		AsyncFileBuffer buffer;
+		buffer.open(FILE_PATH);
+		ostream output(&buffer);
+		ostringstream expected;
+		for(int i = 0; i < 500000; i++) {
+			output << i << "\n";
+			expected << i << "\n";
+			if(i % 100000 == 0) {
+				output.flush();
+			}
+		}
+		TS_ASSERT_LESS_THAN(AsyncFileBuffer::CHUNK_SIZE * AsyncFileBuffer::CHUNK_COUNT, (int)expected.str().size());
+		buffer.close();
+		TS_ASSERT_EQUALS(this->readFile(), expected.str());
+		remove(FILE_PATH);
+	}
+
+	void testReopen() {
+		//Opening a file again truncates it
+		AsyncFileBuffer buffer;
+		ostream output(&buffer);
+		buffer.open(FILE_PATH);
+		output << "first";
+		buffer.open(FILE_PATH);
+		output << "second";
+		buffer.close();
+		TS_ASSERT_EQUALS(this->readFile(), "second");
+		remove(FILE_PATH);
+	}
+
+	void testOpenFailure() {
+		AsyncFileBuffer buffer;
+		TS_ASSERT_THROWS(buffer.open("no/such/directory/file.out"), runtime_error);
+		TS_ASSERT(!buffer.is_open());
+	}
+
+	void testWriteFailure() {
+		//Writes to a full device fail, and the failure reaches the producer
+		AsyncFileBuffer buffer;
+		ostream output(&buffer);
+		buffer.open("/dev/full");
+		output << string(3 * AsyncFileBuffer::CHUNK_SIZE, 'x');
+		TS_ASSERT_THROWS(buffer.flush(), runtime_error);
+		TS_ASSERT(buffer.failed());
+		output << "more";
+		TS_ASSERT_THROWS(buffer.close(), runtime_error);
+		TS_ASSERT(!buffer.is_open());
+		//Output that never leaves the last chunk fails on close
+		buffer.open("/dev/full");
+		output.clear();
+		output << "short";
+		TS_ASSERT_THROWS(buffer.close(), runtime_error);
+	}
+
+private:
+
+	static constexpr const char* FILE_PATH = "AsyncFileBufferTest.out";
+
+	string readFile() {
+		ifstream file(FILE_PATH, ifstream::in | ifstream::binary);
+		ostringstream contents;
+		contents << file.rdbuf();
+		return contents.str();
+	}
+
+};
+
+#endif
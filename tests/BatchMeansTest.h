@@ -0,0 +1,71 @@
+/**
+ * @file BatchMeansTest.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Contains unit tests for the BatchMeans class.
+ */
+
+#ifndef BATCH_MEANS_TEST_H
+#define BATCH_MEANS_TEST_H
+
+//Protected includes
+#include <cmath>
+#include <string>
+#include <stdexcept>
+#include <cxxtest/TestSuite.h>
+
+//Class header include
+#include "../lib/BatchMeans.h"
+
+using namespace std;
+
+class BatchMeansTest : public CxxTest::TestSuite {
+
+public:
+
+	void testConstructor() {
+		TS_ASSERT_THROWS(BatchMeans m(0), invalid_argument);
+		BatchMeans m(2);
+		TS_ASSERT_EQUALS(m.dimensions(), 2);
+		TS_ASSERT_EQUALS(m.batchCount(), 0);
+		//No interval can be given before there are two batches
+		TS_ASSERT_EQUALS(m.halfWidth(0), HUGE_VAL);
+	}
+
+	void testInterval() {
+		BatchMeans m(2);
+		double batches[3][2] = { { 1, 5 }, { 2, 5 }, { 3, 5 } };
+		for(int b = 0; b < 3; b++) {
+			m.addBatch(batches[b]);
+		}
+		TS_ASSERT_EQUALS(m.batchCount(), 3);
+		TS_ASSERT_DELTA(m.mean(0), 2.0, 1e-12);
+		TS_ASSERT_DELTA(m.mean(1), 5.0, 1e-12);
+		//The batch means' variance is 1, so the half-width is z * sqrt(1 / 3)
+		TS_ASSERT_DELTA(m.halfWidth(0), BatchMeans::Z_95 * sqrt(1.0 / 3), 1e-12);
+		TS_ASSERT_DELTA(m.halfWidth(1), 0.0, 1e-12);
+		TS_ASSERT_DELTA(m.maximumHalfWidth(), m.halfWidth(0), 1e-12);
+		m.clear();
+		TS_ASSERT_EQUALS(m.batchCount(), 0);
+		TS_ASSERT_EQUALS(m.mean(0), 0.0);
+	}
+
+	void testIsWithin() {
+		//Intervals are only trusted after MINIMUM_BATCHES batches, however narrow
+		BatchMeans m(1);
+		double mean = 0.25;
+		for(int b = 1; b < BatchMeans::MINIMUM_BATCHES; b++) {
+			m.addBatch(&mean);
+			TS_ASSERT(!m.isWithin(0.01));
+		}
+		m.addBatch(&mean);
+		TS_ASSERT(m.isWithin(0.01));
+		double outlier = 10.0;
+		m.addBatch(&outlier);
+		TS_ASSERT(!m.isWithin(0.01));
+	}
+
+};
+
+#endif
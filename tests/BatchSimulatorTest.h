@@ -0,0 +1,80 @@
+/**
+ * @file BatchSimulatorTest.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Contains unit tests for the Monopoly BatchSimulator class.
+ */
+
+#ifndef BATCH_SIMULATOR_TEST_H
+#define BATCH_SIMULATOR_TEST_H
+
+//Protected includes
+#include <iostream>
+#include <string>
+#include <stdexcept>
+#include <cxxtest/TestSuite.h>
+
+//Class dependencies
+#include "../SimulatorConfig.h"
+#include "../Board.h"
+
+//Class header include
+#include "../BatchSimulator.h"
+
+using namespace std;
+
+class BatchSimulatorTest : public CxxTest::TestSuite {
+
+public:
+
+	void testVerboseIsRejected() {
+		char* argv[] = { (char*)"a.out", (char*)"4", (char*)"10", (char*)"42", (char*)"-v" };
+		TS_ASSERT_THROWS(BatchSimulator b((SimulatorConfig(5, argv))), invalid_argument);
+	}
+
+	void testSameSeedSameCounts() {
+		BatchSimulator a(this->config());
+		BatchSimulator b(this->config());
+		a.simulateGames(0, 10);
+		b.simulateGames(0, 10);
+		for(int i = 0; i < Board::BOARD_SIZE; i++) {
+			TS_ASSERT_EQUALS(a.landingCount(i), b.landingCount(i));
+		}
+	}
+
+	void testGamesDoNotDependOnBlocks() {
+		//Game k must play out the same whether it runs in lane k of one block
+		//or in some other lane of a later block
+		BatchSimulator whole(this->config());
+		BatchSimulator split(this->config());
+		whole.simulateGames(0, BatchSimulator::LANES + 44);
+		split.simulateGames(0, 100);
+		split.simulateGames(100, BatchSimulator::LANES - 56);
+		for(int i = 0; i < Board::BOARD_SIZE; i++) {
+			TS_ASSERT_EQUALS(whole.landingCount(i), split.landingCount(i));
+		}
+	}
+
+	void testEveryTurnIsCounted() {
+		BatchSimulator b(this->config());
+		b.simulateGames(0, 50);
+		unsigned long long total = 0;
+		for(int i = 0; i < Board::BOARD_SIZE; i++) {
+			total += b.landingCount(i);
+		}
+		//Each turn lands at least once, unless the Player stays in Jail
+		TS_ASSERT(total > 50 * 4 * 100 * 3 / 4);
+		TS_ASSERT(b.landingCount(Board::JAIL_LOCATION) > b.landingCount(Board::JAIL_LOCATION + 1));
+	}
+
+private:
+
+	SimulatorConfig config() {
+		char* argv[] = { (char*)"a.out", (char*)"4", (char*)"100", (char*)"42" };
+		return SimulatorConfig(4, argv);
+	}
+
+};
+
+#endif
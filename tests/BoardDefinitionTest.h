@@ -0,0 +1,198 @@
+/**
+ * @file BoardDefinitionTest.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Contains unit tests for the Monopoly BoardDefinition class.
+ */
+
+#ifndef BOARD_DEFINITION_TEST_H
+#define BOARD_DEFINITION_TEST_H
+
+//Protected includes
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <stdexcept>
+#include <cxxtest/TestSuite.h>
+
+//Class dependencies
+#include "../Board.h"
+#include "../Property.h"
+#include "../Card.h"
+#include "../CardDecks.h"
+#include "../ClassicBoard.h"
+#include "../SimulatorConfig.h"
+
+//Class header include
+#include "../BoardDefinition.h"
+
+using namespace std;
+
+class BoardDefinitionTest : public CxxTest::TestSuite {
+
+public:
+
+	void testClassic() {
+		shared_ptr<const BoardDefinition> classic = BoardDefinition::classic();
+		TS_ASSERT_EQUALS(classic, BoardDefinition::classic());
+		TS_ASSERT_EQUALS(classic->size(), Board::BOARD_SIZE);
+		TS_ASSERT_EQUALS(classic->jailLocation(), Board::JAIL_LOCATION);
+		TS_ASSERT_EQUALS(string(classic->tileName(39)), "Boardwalk");
+		TS_ASSERT_EQUALS(classic->kind(30), Property::GO_TO_JAIL);
+		TS_ASSERT_EQUALS(classic->nearestRailroad(7), 15);
+		TS_ASSERT_EQUALS(classic->nearestRailroad(36), 5);
+		TS_ASSERT_EQUALS(classic->nearestRailroad(5), 15);
+		TS_ASSERT_EQUALS(classic->nearestUtility(22), 28);
+		TS_ASSERT_EQUALS(classic->nearestUtility(36), 12);
+		for(int d = 0; d < CardDecks::DECK_COUNT; d++) {
+			CardDecks::Deck deck = (CardDecks::Deck)d;
+			TS_ASSERT_EQUALS(classic->deckSize(deck), CardDecks::SIZE[d]);
+			TS_ASSERT_EQUALS(classic->keptCard(deck), CardDecks::KEPT_CARD[d]);
+			TS_ASSERT_EQUALS(string(classic->card(deck, 0).description()), CardDecks::CARDS[d][0].description());
+		}
+	}
+
+	void testClassicTables() {
+		//The classic board is served from the constexpr tables, and isn't reference counted
+		shared_ptr<const BoardDefinition> classic = BoardDefinition::classic();
+		TS_ASSERT_EQUALS(classic.use_count(), 0);
+		for(int i = 0; i < ClassicBoard::SIZE; i++) {
+			TS_ASSERT_EQUALS(string(classic->tileName(i)), ClassicBoard::TILES[i].name);
+			TS_ASSERT_EQUALS(classic->kind(i), ClassicBoard::TILES[i].kind);
+			TS_ASSERT_EQUALS(classic->nearestRailroad(i), ClassicBoard::NEAREST_RAILROAD.at[i]);
+			TS_ASSERT_EQUALS(classic->nearestUtility(i), ClassicBoard::NEAREST_UTILITY.at[i]);
+		}
+		//A Board populated from it shares its names
+		Board board;
+		board.populate(*classic);
+		TS_ASSERT_EQUALS(board.propertyAt(39).name(), classic->tileName(39));
+	}
+
+	void testParse() {
+		shared_ptr<const BoardDefinition> board = this->parse(this->smallBoard());
+		TS_ASSERT_EQUALS(board->name(), "Small");
+		TS_ASSERT_EQUALS(board->size(), 12);
+		TS_ASSERT_EQUALS(string(board->tileName(1)), "Short Line");
+		TS_ASSERT_EQUALS(board->kind(1), Property::RAILROAD);
+		TS_ASSERT_EQUALS(board->kind(2), Property::PLAIN);
+		TS_ASSERT_EQUALS(board->jailLocation(), 3);
+		//Jump tables wrap around the Board; there is no Utility at all
+		TS_ASSERT_EQUALS(board->nearestRailroad(0), 1);
+		TS_ASSERT_EQUALS(board->nearestRailroad(1), 7);
+		TS_ASSERT_EQUALS(board->nearestRailroad(9), 1);
+		TS_ASSERT_EQUALS(board->nearestUtility(0), -1);
+		TS_ASSERT_EQUALS(board->deckSize(CardDecks::CHANCE_DECK), 3);
+		TS_ASSERT_EQUALS(board->card(CardDecks::CHANCE_DECK, 1).effect(), Card::MOVE_BY);
+		TS_ASSERT_EQUALS(board->card(CardDecks::CHANCE_DECK, 1).argument(), -3);
+		TS_ASSERT_EQUALS(string(board->card(CardDecks::CHANCE_DECK, 2).description()), "Bank pays you");
+		TS_ASSERT_EQUALS(board->keptCard(CardDecks::CHANCE_DECK), 0);
+		TS_ASSERT_EQUALS(board->deckSize(CardDecks::COMMUNITY_CHEST_DECK), 0);
+		TS_ASSERT_EQUALS(board->keptCard(CardDecks::COMMUNITY_CHEST_DECK), -1);
+	}
+
+	void testInvalidDefinitions() {
+		//Each problem is reported with the line it was found on
+		string message;
+		try {
+			this->parse("tile Go\ntile Somewhere | castle\n");
+		} catch(const invalid_argument& e) {
+			message = e.what();
+		}
+		TS_ASSERT_EQUALS(message.find("test:2:"), 0u);
+		TS_ASSERT_THROWS(this->parse("tile\n"), invalid_argument);
+		TS_ASSERT_THROWS(this->parse("station Go\n"), invalid_argument);
+		TS_ASSERT_THROWS(this->parse("chance Advance | move_to\n"), invalid_argument);
+		TS_ASSERT_THROWS(this->parse("chance Advance | move_to 1 2\n"), invalid_argument);
+		//Problems with the Board as a whole
+		TS_ASSERT_THROWS(this->parse("tile Go\ntile Jail | jail\n"), invalid_argument);
+		TS_ASSERT_THROWS(this->parse(this->smallBoard() + "chance Advance | move_to 12\n"), invalid_argument);
+		TS_ASSERT_THROWS(this->parse(this->smallBoard() + "chance Nearest | nearest_utility\n"), invalid_argument);
+		TS_ASSERT_THROWS(this->parse(this->smallBoard() + "chance Another | keep\n"), invalid_argument);
+		TS_ASSERT_THROWS(this->parse(this->smallBoard() + "tile Chest | community_chest\n"), invalid_argument);
+		string jailless = this->smallBoard();
+		jailless.replace(jailless.find(" | jail"), 7, "");
+		TS_ASSERT_THROWS(this->parse(jailless), invalid_argument);
+	}
+
+	void testChainsCantEmptyADeck() {
+		//With the kept card held, a card that leads back to the Chance tile would find the deck empty
+		string chained = this->smallBoard();
+		chained.erase(chained.find("chance Go back"));
+		TS_ASSERT_THROWS(this->parse(chained + "chance Again | move_to 4\n"), invalid_argument);
+		TS_ASSERT_THROWS(this->parse(chained + "chance Lap | move_by 12\n"), invalid_argument);
+		//One more card leaves something to draw
+		shared_ptr<const BoardDefinition> board = this->parse(chained + "chance Again | move_to 4\nchance Stay\n");
+		TS_ASSERT_EQUALS(board->deckSize(CardDecks::CHANCE_DECK), 3);
+		//The classic decks pass the same check, at compile time
+		TS_ASSERT(ClassicBoard::decksLast());
+	}
+
+	void testLoad() {
+		shared_ptr<const BoardDefinition> uk = BoardDefinition::load("boards/uk.board");
+		TS_ASSERT_EQUALS(uk->name(), "UK");
+		TS_ASSERT_EQUALS(uk->size(), Board::BOARD_SIZE);
+		TS_ASSERT_EQUALS(string(uk->tileName(39)), "Mayfair");
+		TS_ASSERT_EQUALS(uk->jailLocation(), Board::JAIL_LOCATION);
+		TS_ASSERT_THROWS(BoardDefinition::load("boards/missing.board"), runtime_error);
+	}
+
+	void testFingerprint() {
+		//Anything that changes play changes the fingerprint; the same tiles and cards don't
+		shared_ptr<const BoardDefinition> classic = BoardDefinition::classic();
+		TS_ASSERT_EQUALS(BoardDefinition::load("boards/classic.board")->fingerprint(), classic->fingerprint());
+		TS_ASSERT_DIFFERS(BoardDefinition::load("boards/uk.board")->fingerprint(), classic->fingerprint());
+		unsigned long long small = this->parse(this->smallBoard())->fingerprint();
+		TS_ASSERT_EQUALS(this->parse(this->smallBoard())->fingerprint(), small);
+		string renamed = this->smallBoard();
+		renamed.replace(renamed.find("tile B"), 6, "tile Q");
+		TS_ASSERT_DIFFERS(this->parse(renamed)->fingerprint(), small);
+		string reordered = this->smallBoard();
+		reordered.replace(reordered.find("move_by -3"), 10, "move_by -2");
+		TS_ASSERT_DIFFERS(this->parse(reordered)->fingerprint(), small);
+	}
+
+	void testConfig() {
+		const char* argv[] = { "a.out", "2", "10", "1", "--board", "boards/tournament32.board" };
+		SimulatorConfig config(6, (char**)argv);
+		TS_ASSERT(config.hasCustomBoard());
+		TS_ASSERT_EQUALS(config.board()->size(), 32);
+		TS_ASSERT_EQUALS(config.outputPath(), "output/2p10r1s-tournament32.out");
+		SimulatorConfig classic(2, 10, true, 1);
+		TS_ASSERT(!classic.hasCustomBoard());
+		TS_ASSERT_EQUALS(classic.board(), BoardDefinition::classic());
+	}
+
+private:
+
+	/* A 12-tile board with one Chance deck and no Utility */
+	string smallBoard() {
+		return "# A small board\n"
+			   "name Small\n"
+			   "tile Go\n"
+			   "tile Short Line | railroad\n"
+			   "tile A | plain\n"
+			   "tile Jail | jail\n"
+			   "tile Chance | chance\n"
+			   "tile B\n"
+			   "tile C\n"
+			   "tile Reading Railroad | railroad\n"
+			   "tile D\n"
+			   "\n"
+			   "tile E\n"
+			   "tile Go To Jail | go_to_jail\n"
+			   "tile F\n"
+			   "chance Get Out of Jail Free | keep\n"
+			   "chance Go back | move_by -3\n"
+			   "chance   Bank pays you   # a comment\n";
+	}
+
+	shared_ptr<const BoardDefinition> parse(const string& text) {
+		istringstream input(text);
+		return BoardDefinition::parse(input, "test");
+	}
+
+};
+
+#endif
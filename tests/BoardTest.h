@@ -38,9 +38,9 @@ public:
 	void testPropertyAt() {
 		Board b;
 		this->populateBoard(b);
-		TS_ASSERT_EQUALS(b.propertyAt(0).name(), "Go");
-		TS_ASSERT_EQUALS(b.propertyAt(1).name(), "Mediterranean Avenue");
-		TS_ASSERT_EQUALS(b.propertyAt(2).name(), "Community Chest");
+		TS_ASSERT_EQUALS(string(b.propertyAt(0).name()), "Go");
+		TS_ASSERT_EQUALS(string(b.propertyAt(1).name()), "Mediterranean Avenue");
+		TS_ASSERT_EQUALS(string(b.propertyAt(2).name()), "Community Chest");
 		TS_ASSERT_EQUALS(b.propertyAt(-1).name(), b.propertyAt(39).name());
 		TS_ASSERT_EQUALS(b.propertyAt(-2).name(), b.propertyAt(38).name());
 	}
@@ -63,50 +63,76 @@ public:
 		TS_ASSERT_EQUALS(&(b.propertyAt(first, 1)), &(next));
 	}
 
+	void testAddProperty() {
+		Board b;
+		TS_ASSERT_EQUALS(b.size(), 0);
+		TS_ASSERT_THROWS(b.propertyAt(0), length_error);
+		Property& go = b.addProperty("Go");
+		TS_ASSERT_EQUALS(&go, &(b.propertyAt(0)));
+		TS_ASSERT_EQUALS(b.propertyAt(0).kind(), Property::PLAIN);
+		b.addProperty("Reading Railroad", Property::RAILROAD);
+		TS_ASSERT_EQUALS(b.propertyAt(1).kind(), Property::RAILROAD);
+		for(int i = 2; i < Board::MAXIMUM_SIZE; i++) {
+			b.addProperty("Somewhere");
+		}
+		TS_ASSERT_EQUALS(b.size(), Board::MAXIMUM_SIZE);
+		TS_ASSERT_THROWS(b.addProperty("Somewhere over the Rainbow"), length_error);
+	}
+
+	void testPopulateClassic() {
+		Board b;
+		TS_ASSERT_EQUALS(b.jailLocation(), -1);
+		b.populateClassic();
+		TS_ASSERT_EQUALS(b.size(), Board::BOARD_SIZE);
+		TS_ASSERT_EQUALS(b.jailLocation(), Board::JAIL_LOCATION);
+		TS_ASSERT_EQUALS(b.propertyAt(Board::JAIL_LOCATION).kind(), Property::JAIL);
+		TS_ASSERT_EQUALS(b.wrap(Board::BOARD_SIZE + 3), 3);
+	}
+
 private:
 
 	void populateBoard(Board& b) {
-		//Populate the Board with Monopoly properties - MEMORY LEAK!
-		b.addProperty(*(new Property("Go")));
-		b.addProperty(*(new Property("Mediterranean Avenue")));
-		b.addProperty(*(new Property("Community Chest")));
-		b.addProperty(*(new Property("Baltic Avenue")));
-		b.addProperty(*(new Property("Income Tax")));
-		b.addProperty(*(new Property("Reading Railroad")));
-		b.addProperty(*(new Property("Oriental Avenue")));
-		b.addProperty(*(new Property("Chance")));
-		b.addProperty(*(new Property("Vermont Avenue")));
-		b.addProperty(*(new Property("Connecticut Avenue")));
-		b.addProperty(*(new Property("In Jail/Just Visiting")));
-		b.addProperty(*(new Property("St. Charles Place")));
-		b.addProperty(*(new Property("Electric Company")));
-		b.addProperty(*(new Property("States Avenue")));
-		b.addProperty(*(new Property("Virginia Avenue")));
-		b.addProperty(*(new Property("Pennsylvania Railroad")));
-		b.addProperty(*(new Property("St. James Place")));
-		b.addProperty(*(new Property("Community Chest")));
-		b.addProperty(*(new Property("Tennessee Avenue")));
-		b.addProperty(*(new Property("New York Avenue")));
-		b.addProperty(*(new Property("Free Parking")));
-		b.addProperty(*(new Property("Kentucky Avenue")));
-		b.addProperty(*(new Property("Chance")));
-		b.addProperty(*(new Property("Indiana Avenue")));
-		b.addProperty(*(new Property("Illinois Avenue")));
-		b.addProperty(*(new Property("B. & O. Railroad")));
-		b.addProperty(*(new Property("Alantic Avenue")));
-		b.addProperty(*(new Property("Ventnor Avenue")));
-		b.addProperty(*(new Property("Water Works")));
-		b.addProperty(*(new Property("Marvin Gardens")));
-		b.addProperty(*(new Property("Go To Jail")));
-		b.addProperty(*(new Property("Pacific Avenue")));
-		b.addProperty(*(new Property("North Carolina AVenue")));
-		b.addProperty(*(new Property("Community Chest")));
-		b.addProperty(*(new Property("Pennsylvania Avenue")));
-		b.addProperty(*(new Property("Short Line")));
-		b.addProperty(*(new Property("Chance")));
-		b.addProperty(*(new Property("Park Place")));
-		b.addProperty(*(new Property("Luxury Tax")));
-		b.addProperty(*(new Property("Boardwalk")));		
+		//Populate the Board with Monopoly properties
+		b.addProperty("Go");
+		b.addProperty("Mediterranean Avenue");
+		b.addProperty("Community Chest");
+		b.addProperty("Baltic Avenue");
+		b.addProperty("Income Tax");
+		b.addProperty("Reading Railroad");
+		b.addProperty("Oriental Avenue");
+		b.addProperty("Chance");
+		b.addProperty("Vermont Avenue");
+		b.addProperty("Connecticut Avenue");
+		b.addProperty("In Jail/Just Visiting");
+		b.addProperty("St. Charles Place");
+		b.addProperty("Electric Company");
+		b.addProperty("States Avenue");
+		b.addProperty("Virginia Avenue");
+		b.addProperty("Pennsylvania Railroad");
+		b.addProperty("St. James Place");
+		b.addProperty("Community Chest");
+		b.addProperty("Tennessee Avenue");
+		b.addProperty("New York Avenue");
+		b.addProperty("Free Parking");
+		b.addProperty("Kentucky Avenue");
+		b.addProperty("Chance");
+		b.addProperty("Indiana Avenue");
+		b.addProperty("Illinois Avenue");
+		b.addProperty("B. & O. Railroad");
+		b.addProperty("Alantic Avenue");
+		b.addProperty("Ventnor Avenue");
+		b.addProperty("Water Works");
+		b.addProperty("Marvin Gardens");
+		b.addProperty("Go To Jail");
+		b.addProperty("Pacific Avenue");
+		b.addProperty("North Carolina AVenue");
+		b.addProperty("Community Chest");
+		b.addProperty("Pennsylvania Avenue");
+		b.addProperty("Short Line");
+		b.addProperty("Chance");
+		b.addProperty("Park Place");
+		b.addProperty("Luxury Tax");
+		b.addProperty("Boardwalk");		
 	}
 
 };
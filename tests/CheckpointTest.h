@@ -0,0 +1,86 @@
+/**
+ * @file CheckpointTest.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Contains unit tests for the CheckpointWriter and CheckpointReader classes.
+ */
+
+#ifndef CHECKPOINT_TEST_H
+#define CHECKPOINT_TEST_H
+
+//Protected includes
+#include <climits>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <stdexcept>
+#include <cxxtest/TestSuite.h>
+
+//Class header include
+#include "../Checkpoint.h"
+
+using namespace std;
+
+class CheckpointTest : public CxxTest::TestSuite {
+
+public:
+
+	void testRoundTrip() {
+		long long values[] = { 0, 1, -1, 63, -64, 64, 300, INT_MAX, LLONG_MAX, LLONG_MIN };
+		CheckpointWriter writer(CHECKPOINT_PATH);
+		for(int i = 0; i < 10; i++) {
+			writer.put(values[i]);
+		}
+		writer.commit();
+		CheckpointReader reader(CHECKPOINT_PATH);
+		for(int i = 0; i < 10; i++) {
+			TS_ASSERT_EQUALS(reader.get(), values[i]);
+		}
+		//Reading past the end
+		TS_ASSERT_THROWS(reader.get(), runtime_error);
+		remove(CHECKPOINT_PATH);
+	}
+
+	void testRange() {
+		CheckpointWriter writer(CHECKPOINT_PATH);
+		writer.put(5);
+		writer.put(5);
+		writer.commit();
+		CheckpointReader reader(CHECKPOINT_PATH);
+		TS_ASSERT_EQUALS(reader.get(0, 5), 5);
+		TS_ASSERT_THROWS(reader.get(0, 4), runtime_error);
+		remove(CHECKPOINT_PATH);
+	}
+
+	void testUncommittedCheckpointIsNotVisible() {
+		//A checkpoint that is still being written leaves the previous one in place
+		CheckpointWriter first(CHECKPOINT_PATH);
+		first.put(1);
+		first.commit();
+		{
+			CheckpointWriter second(CHECKPOINT_PATH);
+			second.put(2);
+		}
+		CheckpointReader reader(CHECKPOINT_PATH);
+		TS_ASSERT_EQUALS(reader.get(), 1);
+		remove(CHECKPOINT_PATH);
+		remove((string(CHECKPOINT_PATH) + ".tmp").c_str());
+	}
+
+	void testNotACheckpoint() {
+		ofstream file(CHECKPOINT_PATH);
+		file << "Num Players: 3 Turns: 10\n";
+		file.close();
+		TS_ASSERT_THROWS(CheckpointReader reader(CHECKPOINT_PATH), runtime_error);
+		remove(CHECKPOINT_PATH);
+		TS_ASSERT_THROWS(CheckpointReader reader(CHECKPOINT_PATH), runtime_error);
+	}
+
+private:
+
+	static constexpr const char* CHECKPOINT_PATH = "CheckpointTest.ckpt";
+
+};
+
+#endif
@@ -0,0 +1,93 @@
+/**
+ * @file DiceTest.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Contains unit tests for the DiceStream class.
+ */
+
+#ifndef DICE_TEST_H
+#define DICE_TEST_H
+
+//Protected includes
+#include <iostream>
+#include <string>
+#include <stdexcept>
+#include <cxxtest/TestSuite.h>
+
+//Class header include
+#include "../Dice.h"
+
+using namespace std;
+
+class DiceTest : public CxxTest::TestSuite {
+
+public:
+
+	void testRollRange() {
+		DiceStream d(42, 0, 0);
+		for(int i = 0; i < 10 * DiceStream::BUFFER_SIZE; i++) {
+			int n = d.roll();
+			TS_ASSERT(n >= 1 && n <= 6);
+		}
+	}
+
+	void testSameAddressSameRolls() {
+		DiceStream a(42, 3, 1);
+		DiceStream b(42, 3, 1);
+		DiceStream c(42, 3, 2);
+		int same = 0;
+		for(int i = 0; i < 1000; i++) {
+			int n = a.roll();
+			TS_ASSERT_EQUALS(n, b.roll());
+			same += (n == c.roll());
+		}
+		//Independent streams agree on about 1 roll in 6
+		TS_ASSERT_DELTA(same, 1000 / 6, 50);
+	}
+
+	void testSeek() {
+		//A stream moved to another's position continues with the same rolls
+		DiceStream a(42, 0, 1);
+		for(int i = 0; i < DiceStream::BUFFER_SIZE + 17; i++) {
+			a.roll();
+		}
+		DiceStream b(42, 0, 1);
+		b.seek(a.blocksUsed(), a.rollsUsed());
+		for(int i = 0; i < 3 * DiceStream::BUFFER_SIZE; i++) {
+			TS_ASSERT_EQUALS(a.roll(), b.roll());
+		}
+		//Seeking to the start rewinds the stream
+		DiceStream fresh(42, 0, 1);
+		b.seek(0, 0);
+		TS_ASSERT_EQUALS(b.blocksUsed(), 0ULL);
+		for(int i = 0; i < 100; i++) {
+			TS_ASSERT_EQUALS(fresh.roll(), b.roll());
+		}
+	}
+
+	void testRollsAreUniform() {
+		DiceStream d(7, 0, 0);
+		int counts[7] = { 0, 0, 0, 0, 0, 0, 0 };
+		int pairs[6][6] = { { 0 } };
+		int previous = d.roll();
+		for(int i = 0; i < 360000; i++) {
+			int n = d.roll();
+			counts[n]++;
+			pairs[previous - 1][n - 1]++;
+			previous = n;
+		}
+		for(int i = 1; i <= 6; i++) {
+			TS_ASSERT_DELTA(counts[i], 60000, 1000);
+		}
+		//Consecutive digits of a word must not be correlated
+		for(int i = 0; i < 6; i++) {
+			for(int j = 0; j < 6; j++) {
+				TS_ASSERT_DELTA(pairs[i][j], 10000, 450);
+			}
+		}
+	}
+
+};
+
+#endif
@@ -0,0 +1,116 @@
+/**
+ * @file GameStateTest.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Contains unit tests for the packed PlayerState and DeckCursor classes.
+ */
+
+#ifndef GAME_STATE_TEST_H
+#define GAME_STATE_TEST_H
+
+//Protected includes
+#include <iostream>
+#include <string>
+#include <stdexcept>
+#include <cxxtest/TestSuite.h>
+
+//Class dependencies
+#include "../CardDecks.h"
+#include "../Player.h"
+
+//Class header include
+#include "../GameState.h"
+
+using namespace std;
+
+class GameStateTest : public CxxTest::TestSuite {
+
+public:
+
+	void testSizes() {
+		TS_ASSERT_EQUALS(sizeof(PlayerState), 2u);
+		TS_ASSERT_EQUALS(sizeof(DeckCursor), 2u);
+	}
+
+	void testPlayerFieldsAreIndependent() {
+		PlayerState s;
+		TS_ASSERT_EQUALS(s.location(), 0);
+		TS_ASSERT(!s.isDetained());
+		TS_ASSERT(!s.hasGetOutOfJailCard());
+		s.setLocation(PlayerState::LOCATION_COUNT - 1);
+		s.setGetOutOfJailCard(CardDecks::COMMUNITY_CHEST_DECK, true);
+		s.setJail(1, PlayerState::MAXIMUM_JAIL_SENTENCE);
+		TS_ASSERT_EQUALS(s.location(), PlayerState::LOCATION_COUNT - 1);
+		TS_ASSERT(s.isDetained());
+		TS_ASSERT_EQUALS(s.turnsInJail(), PlayerState::MAXIMUM_JAIL_SENTENCE);
+		TS_ASSERT(!s.hasGetOutOfJailCard(CardDecks::CHANCE_DECK));
+		TS_ASSERT(s.hasGetOutOfJailCard(CardDecks::COMMUNITY_CHEST_DECK));
+		s.setLocation(10);
+		s.setDetention(false);
+		s.setGetOutOfJailCard(CardDecks::COMMUNITY_CHEST_DECK, false);
+		TS_ASSERT_EQUALS(s.location(), 10);
+		TS_ASSERT(!s.isDetained());
+		TS_ASSERT_EQUALS(s.turnsInJail(), 0);
+		TS_ASSERT(!s.hasGetOutOfJailCard());
+		//A location beyond the field leaves the other fields alone
+		s.setJail(1, 1);
+		s.setGetOutOfJailCard(CardDecks::CHANCE_DECK, true);
+		s.setLocation(-1);
+		TS_ASSERT(s.isDetained());
+		TS_ASSERT_EQUALS(s.turnsInJail(), 1);
+		TS_ASSERT(s.hasGetOutOfJailCard(CardDecks::CHANCE_DECK));
+		TS_ASSERT(!s.hasGetOutOfJailCard(CardDecks::COMMUNITY_CHEST_DECK));
+	}
+
+	void testTurnsInJail() {
+		//Turns are only counted while detained, and saturate rather than spill over
+		PlayerState s;
+		s.incrementTurnsInJail();
+		TS_ASSERT_EQUALS(s.turnsInJail(), 0);
+		s.setDetention(true);
+		for(int i = 0; i < 10; i++) {
+			s.incrementTurnsInJail();
+		}
+		TS_ASSERT_EQUALS(s.turnsInJail(), 3);
+		TS_ASSERT(s.isDetained());
+		TS_ASSERT(!s.hasGetOutOfJailCard());
+		//A Player's cards live in their PlayerState
+		Player p(0);
+		p.setGetOutOfJailCard(CardDecks::CHANCE_DECK, true);
+		TS_ASSERT(p.hasGetOutOfJailCard(CardDecks::CHANCE_DECK));
+		TS_ASSERT(!p.hasGetOutOfJailCard(CardDecks::COMMUNITY_CHEST_DECK));
+	}
+
+	void testDeckCursor() {
+		//Follow a full deck of the largest size around its ring
+		const int size = CardDecks::MAXIMUM_DECK_SIZE;
+		DeckCursor c;
+		c.reset(size);
+		TS_ASSERT_EQUALS(c.head(), 0);
+		TS_ASSERT_EQUALS(c.size(), size);
+		TS_ASSERT_EQUALS(c.undrawn(), size);
+		for(int draw = 1; draw <= 3 * size; draw++) {
+			c.pop(size);
+			TS_ASSERT_EQUALS(c.size(), size - 1);
+			c.push();
+			TS_ASSERT_EQUALS(c.head(), draw % size);
+			TS_ASSERT_EQUALS(c.size(), size);
+		}
+		//Draws are counted down separately, down to none
+		for(int draw = 0; draw < size; draw++) {
+			c.countDraw();
+		}
+		TS_ASSERT_EQUALS(c.undrawn(), 0);
+		TS_ASSERT_EQUALS(c.size(), size);
+		//A kept card stays out of the deck
+		c.reset(size);
+		c.pop(size);
+		TS_ASSERT_EQUALS(c.size(), size - 1);
+		TS_ASSERT_EQUALS(c.head(), 1);
+		TS_ASSERT_EQUALS(c.undrawn(), size);
+	}
+
+};
+
+#endif
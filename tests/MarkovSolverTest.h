@@ -0,0 +1,131 @@
+/**
+ * @file MarkovSolverTest.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Contains unit tests for the Monopoly MarkovSolver class.
+ */
+
+#ifndef MARKOV_SOLVER_TEST_H
+#define MARKOV_SOLVER_TEST_H
+
+//Protected includes
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <stdexcept>
+#include <cxxtest/TestSuite.h>
+
+//Class dependencies
+#include "../SimulatorConfig.h"
+#include "../Board.h"
+#include "../MonteCarloRunner.h"
+
+//Class header include
+#include "../MarkovSolver.h"
+
+using namespace std;
+
+class MarkovSolverTest : public CxxTest::TestSuite {
+
+public:
+
+	void testChain() {
+		MarkovSolver m(this->config());
+		TS_ASSERT_LESS_THAN(0, m.stateCount());
+		TS_ASSERT_LESS_THAN_EQUALS(m.stateCount(), MarkovSolver::MAXIMUM_STATES);
+		TS_ASSERT_LESS_THAN(m.stateCount(), m.transitionCount());
+	}
+
+	void testProbabilities() {
+		MarkovSolver m(this->config());
+		m.solve();
+		TS_ASSERT_EQUALS(m.method(), MarkovSolver::BICGSTAB);
+		TS_ASSERT_LESS_THAN(m.residual(), MarkovSolver::TOLERANCE);
+		double total = 0;
+		for(int i = 0; i < SIZE; i++) {
+			TS_ASSERT_LESS_THAN(0, m.landingProbability(i));
+			total += m.landingProbability(i);
+			//The Jail is the most landed-on Property
+			TS_ASSERT_LESS_THAN_EQUALS(m.landingProbability(i), m.landingProbability(JAIL_LOCATION));
+		}
+		TS_ASSERT_DELTA(total, 1.0, 1e-9);
+	}
+
+	void testMethodsAgree() {
+		MarkovSolver bicgstab(this->config());
+		bicgstab.solve(MarkovSolver::BICGSTAB);
+		MarkovSolver power(this->config());
+		power.solve(MarkovSolver::POWER_ITERATION);
+		TS_ASSERT_EQUALS(power.method(), MarkovSolver::POWER_ITERATION);
+		TS_ASSERT(power.residual() < MarkovSolver::TOLERANCE);
+		TS_ASSERT_LESS_THAN(bicgstab.iterations(), power.iterations());
+		for(int i = 0; i < SIZE; i++) {
+			TS_ASSERT_DELTA(bicgstab.landingProbability(i), power.landingProbability(i), 1e-10);
+		}
+	}
+
+	void testAgreesWithSampling() {
+		//The same lone Player playing 1000 games of 20000 turns: 20 million turns
+		MonteCarloRunner r(this->config("20000"));
+		r.simulateGames(0, 1000);
+		unsigned long long total = 0;
+		for(int i = 0; i < SIZE; i++) {
+			total += r.landingCount(i);
+		}
+		MarkovSolver m(this->config());
+		m.solve();
+		for(int i = 0; i < SIZE; i++) {
+			TS_ASSERT_DELTA(m.landingProbability(i), (double)r.landingCount(i) / total, 0.0002);
+		}
+	}
+
+	void testInvalidOptions() {
+		char* verbose[] = { (char*)"a.out", (char*)"1", (char*)"1", (char*)"42", (char*)"-v", (char*)"--markov", (char*)"--shuffle", (char*)"none" };
+		TS_ASSERT_THROWS(SimulatorConfig(8, verbose), invalid_argument);
+		char* batched[] = { (char*)"a.out", (char*)"1", (char*)"1", (char*)"--games", (char*)"8", (char*)"--markov", (char*)"--shuffle", (char*)"none" };
+		TS_ASSERT_THROWS(SimulatorConfig(8, batched), invalid_argument);
+		//Only a lone Player's unshuffled game is solved exactly
+		char* players[] = { (char*)"a.out", (char*)"3", (char*)"1", (char*)"--markov", (char*)"--shuffle", (char*)"none" };
+		TS_ASSERT_THROWS(SimulatorConfig(6, players), invalid_argument);
+		char* shuffled[] = { (char*)"a.out", (char*)"1", (char*)"1", (char*)"--markov" };
+		TS_ASSERT_THROWS(SimulatorConfig(4, shuffled), invalid_argument);
+		//A lone Player can't play a game
+		char* alone[] = { (char*)"a.out", (char*)"1", (char*)"1", (char*)"--shuffle", (char*)"none" };
+		TS_ASSERT_THROWS(SimulatorConfig(5, alone), invalid_argument);
+		TS_ASSERT_THROWS(SimulatorConfig(1, 1, true, 42), invalid_argument);
+	}
+
+	void testDoubleDrawsAreRefused() {
+		//A Chance card that moves onto another Chance tile draws from Chance twice
+		const char* path = "/tmp/MarkovSolverTest.board";
+		ofstream board(path);
+		board << "name Double Draws\n";
+		for(int i = 0; i < 12; i++) {
+			board << "tile Tile " << i << ((i == 3 || i == 9) ? " | chance" : (i == 6) ? " | jail" : "") << "\n";
+		}
+		board << "chance Go forward 6 spaces | move_by 6\n";
+		board << "chance Go back 6 spaces | move_by -6\n";
+		board << "chance Bank error in your favor\n";
+		board.close();
+		char* argv[] = { (char*)"a.out", (char*)"1", (char*)"1", (char*)"--markov", (char*)"--shuffle", (char*)"none", (char*)"--board", (char*)path };
+		TS_ASSERT_THROWS(MarkovSolver(SimulatorConfig(8, argv)), invalid_argument);
+		remove(path);
+	}
+
+private:
+
+	//The tournament board's chain is small enough to solve quickly
+	static const int SIZE = 32;
+	static const int JAIL_LOCATION = 8;
+
+	SimulatorConfig config(const char* turns = "1") {
+		char* argv[] = { (char*)"a.out", (char*)"1", (char*)turns, (char*)"42", (char*)"--markov", (char*)"--shuffle", (char*)"none",
+						 (char*)"--board", (char*)"boards/tournament32.board" };
+		return SimulatorConfig(9, argv);
+	}
+
+};
+
+#endif
@@ -0,0 +1,139 @@
+/**
+ * @file MonopolyTest.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Contains unit tests for the simulator's C library interface.
+ */
+
+#ifndef MONOPOLY_TEST_H
+#define MONOPOLY_TEST_H
+
+//Protected includes
+#include <cstddef>
+#include <string>
+#include <cxxtest/TestSuite.h>
+
+//Class dependencies
+#include "../SimulatorConfig.h"
+#include "../Board.h"
+#include "../BatchSimulator.h"
+
+//Interface header include
+#include "../monopoly.h"
+
+using namespace std;
+
+class MonopolyTest : public CxxTest::TestSuite {
+
+public:
+
+	void testCountsMatchBatchSimulator() {
+		monopoly_config config = this->config(3, 20, 42, 300);
+		monopoly_simulation* simulation = NULL;
+		unsigned long long counts[MONOPOLY_BOARD_SIZE];
+		TS_ASSERT_EQUALS(monopoly_create(&config, &simulation), MONOPOLY_OK);
+		TS_ASSERT_EQUALS(monopoly_run(simulation), MONOPOLY_OK);
+		TS_ASSERT_EQUALS(monopoly_collect(simulation, counts, MONOPOLY_BOARD_SIZE), MONOPOLY_OK);
+		BatchSimulator batch(SimulatorConfig(3, 20, true, 42));
+		batch.simulateGames(0, 300);
+		for(int i = 0; i < Board::BOARD_SIZE; i++) {
+			TS_ASSERT_EQUALS(counts[i], batch.landingCount(i));
+		}
+		monopoly_destroy(simulation);
+	}
+
+	void testRoundCallback() {
+		monopoly_config config = this->config(4, 50, 7, 1);
+		monopoly_simulation* simulation = NULL;
+		unsigned long long counts[MONOPOLY_BOARD_SIZE];
+		Rounds rounds = { 0, 0 };
+		TS_ASSERT_EQUALS(monopoly_create(&config, &simulation), MONOPOLY_OK);
+		TS_ASSERT_EQUALS(monopoly_set_round_callback(simulation, &MonopolyTest::countRound, &rounds), MONOPOLY_OK);
+		TS_ASSERT_EQUALS(monopoly_run(simulation), MONOPOLY_OK);
+		TS_ASSERT_EQUALS(monopoly_collect(simulation, counts, MONOPOLY_BOARD_SIZE), MONOPOLY_OK);
+		TS_ASSERT_EQUALS(rounds.calls, 50);
+		//The last call sees the final totals
+		unsigned long long total = 0;
+		for(int i = 0; i < MONOPOLY_BOARD_SIZE; i++) {
+			total += counts[i];
+		}
+		TS_ASSERT_EQUALS(rounds.landings, total);
+		monopoly_destroy(simulation);
+	}
+
+	void testErrors() {
+		monopoly_config config = this->config(7, 20, 42, 1);
+		monopoly_simulation* simulation = NULL;
+		unsigned long long counts[MONOPOLY_BOARD_SIZE];
+		TS_ASSERT_EQUALS(monopoly_create(&config, &simulation), MONOPOLY_INVALID_ARGUMENT);
+		TS_ASSERT(simulation == NULL);
+		TS_ASSERT(string(monopoly_last_error()).find("players") != string::npos);
+		config.player_count = 2;
+		TS_ASSERT_EQUALS(monopoly_create(&config, &simulation), MONOPOLY_OK);
+		TS_ASSERT_EQUALS(monopoly_collect(simulation, counts, MONOPOLY_BOARD_SIZE - 1), MONOPOLY_INVALID_ARGUMENT);
+		config.size = 0;
+		TS_ASSERT_EQUALS(monopoly_configure(simulation, &config), MONOPOLY_INVALID_ARGUMENT);
+		monopoly_destroy(simulation);
+	}
+
+	void testPropertyNames() {
+		TS_ASSERT_EQUALS(string(monopoly_property_name(0)), "Go");
+		TS_ASSERT_EQUALS(string(monopoly_property_name(39)), "Boardwalk");
+		TS_ASSERT(monopoly_property_name(40) == NULL);
+	}
+
+	void testBoards() {
+		monopoly_config config = this->config(3, 50, 42, 4);
+		config.board_path = "boards/tournament32.board";
+		monopoly_simulation* simulation = NULL;
+		unsigned long long counts[MONOPOLY_MAXIMUM_BOARD_SIZE];
+		TS_ASSERT_EQUALS(monopoly_create(&config, &simulation), MONOPOLY_OK);
+		TS_ASSERT_EQUALS(monopoly_board_size(simulation), 32);
+		TS_ASSERT_EQUALS(string(monopoly_tile_name(simulation, 31)), "Boardwalk");
+		TS_ASSERT(monopoly_tile_name(simulation, 32) == NULL);
+		TS_ASSERT_EQUALS(monopoly_run(simulation), MONOPOLY_OK);
+		TS_ASSERT_EQUALS(monopoly_collect(simulation, counts, 31), MONOPOLY_INVALID_ARGUMENT);
+		TS_ASSERT_EQUALS(monopoly_collect(simulation, counts, 32), MONOPOLY_OK);
+		TS_ASSERT(counts[8] > 0);
+		//A configuration from before board_path existed plays on the classic board
+		config.size = offsetof(monopoly_config, board_path);
+		TS_ASSERT_EQUALS(monopoly_configure(simulation, &config), MONOPOLY_OK);
+		TS_ASSERT_EQUALS(monopoly_board_size(simulation), MONOPOLY_BOARD_SIZE);
+		config.size = sizeof(monopoly_config);
+		config.board_path = "boards/missing.board";
+		TS_ASSERT_EQUALS(monopoly_configure(simulation, &config), MONOPOLY_RUNTIME_ERROR);
+		monopoly_destroy(simulation);
+	}
+
+private:
+
+	/* What the round callback has seen */
+	struct Rounds {
+		int calls;
+		unsigned long long landings;
+	};
+
+	static void countRound(int round, const unsigned long long* counts, void* user_data) {
+		Rounds* rounds = (Rounds*)user_data;
+		rounds->calls++;
+		rounds->landings = 0;
+		for(int i = 0; i < MONOPOLY_BOARD_SIZE; i++) {
+			rounds->landings += counts[i];
+		}
+	}
+
+	monopoly_config config(int players, int turns, int seed, int games) {
+		monopoly_config config;
+		monopoly_config_init(&config);
+		config.player_count = players;
+		config.turn_count = turns;
+		config.has_seed = 1;
+		config.seed = seed;
+		config.game_count = games;
+		return config;
+	}
+
+};
+
+#endif
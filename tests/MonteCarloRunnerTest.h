@@ -0,0 +1,70 @@
+/**
+ * @file MonteCarloRunnerTest.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Contains unit tests for the Monopoly MonteCarloRunner class.
+ */
+
+#ifndef MONTE_CARLO_RUNNER_TEST_H
+#define MONTE_CARLO_RUNNER_TEST_H
+
+//Protected includes
+#include <iostream>
+#include <string>
+#include <stdexcept>
+#include <cxxtest/TestSuite.h>
+
+//Class dependencies
+#include "../SimulatorConfig.h"
+#include "../Board.h"
+#include "../BatchSimulator.h"
+
+//Class header include
+#include "../MonteCarloRunner.h"
+
+using namespace std;
+
+class MonteCarloRunnerTest : public CxxTest::TestSuite {
+
+public:
+
+	void testThreadCount() {
+		MonteCarloRunner r(this->config("3"));
+		TS_ASSERT_EQUALS(r.threadCount(), 3);
+	}
+
+	void testCountsDoNotDependOnThreads() {
+		//1000 games is 4 chunks (the last one partial) shared by 1, 3 or 7 workers
+		BatchSimulator batch(this->config("1"));
+		batch.simulateGames(5, 1000);
+		const char* threads[] = { "1", "3", "7" };
+		for(int t = 0; t < 3; t++) {
+			MonteCarloRunner r(this->config(threads[t]));
+			r.simulateGames(5, 1000);
+			for(int i = 0; i < Board::BOARD_SIZE; i++) {
+				TS_ASSERT_EQUALS(r.landingCount(i), batch.landingCount(i));
+			}
+		}
+	}
+
+	void testWorkerExceptionsReachTheCaller() {
+		//Every worker's BatchSimulator rejects a verbose run, on its own thread
+		char* argv[] = { (char*)"a.out", (char*)"3", (char*)"20", (char*)"42", (char*)"-v",
+						 (char*)"--threads", (char*)"3" };
+		MonteCarloRunner r(SimulatorConfig(7, argv));
+		TS_ASSERT_THROWS(r.simulateGames(0, 1000), invalid_argument);
+		TS_ASSERT_EQUALS(r.landingCount(0), 0u);
+	}
+
+private:
+
+	SimulatorConfig config(const char* threads) {
+		char* argv[] = { (char*)"a.out", (char*)"3", (char*)"20", (char*)"42",
+						 (char*)"--threads", (char*)threads };
+		return SimulatorConfig(6, argv);
+	}
+
+};
+
+#endif
@@ -26,7 +26,14 @@ public:
 
 	void testName() {
 		Property p("Somewhere over the Rainbow");
-		TS_ASSERT_EQUALS(p.name(), "Somewhere over the Rainbow");
+		TS_ASSERT_EQUALS(string(p.name()), "Somewhere over the Rainbow");
+	}
+
+	void testKind() {
+		Property p("Somewhere over the Rainbow");
+		TS_ASSERT_EQUALS(p.kind(), Property::PLAIN);
+		Property q("Chance", Property::CHANCE);
+		TS_ASSERT_EQUALS(q.kind(), Property::CHANCE);
 	}
 
 	void testIncrementCount() {
@@ -36,6 +43,9 @@ public:
 		p.incrementCount();
 		p.incrementCount();
 		TS_ASSERT_EQUALS(p.count(), 3);
+		p.setCount(1000000);
+		p.incrementCount();
+		TS_ASSERT_EQUALS(p.count(), 1000001);
 	}
 
 };
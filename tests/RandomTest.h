@@ -0,0 +1,96 @@
+/**
+ * @file RandomTest.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Contains unit tests for the RandomStream class.
+ */
+
+#ifndef RANDOM_TEST_H
+#define RANDOM_TEST_H
+
+//Protected includes
+#include <iostream>
+#include <string>
+#include <stdexcept>
+#include <cxxtest/TestSuite.h>
+
+//Class header include
+#include "../Random.h"
+
+using namespace std;
+
+class RandomTest : public CxxTest::TestSuite {
+
+public:
+
+	void testPhiloxKnownAnswers() {
+		//Known-answer vectors published with the Random123 library
+		unsigned int out[4];
+		unsigned int zero[2] = { 0, 0 };
+		RandomStream::philox(zero, 0, 0, 0, 0, out);
+		TS_ASSERT_EQUALS(out[0], 0x6627e8d5u);
+		TS_ASSERT_EQUALS(out[1], 0xe169c58du);
+		TS_ASSERT_EQUALS(out[2], 0xbc57ac4cu);
+		TS_ASSERT_EQUALS(out[3], 0x9b00dbd8u);
+		unsigned int pi[2] = { 0xa4093822u, 0x299f31d0u };
+		RandomStream::philox(pi, 0x243f6a88u, 0x85a308d3u, 0x13198a2eu, 0x03707344u, out);
+		TS_ASSERT_EQUALS(out[0], 0xd16cfe09u);
+		TS_ASSERT_EQUALS(out[1], 0x94fdccebu);
+		TS_ASSERT_EQUALS(out[2], 0x5001e420u);
+		TS_ASSERT_EQUALS(out[3], 0x24126ea1u);
+	}
+
+	void testSameAddressSameNumbers() {
+		RandomStream a(42, 7, 3);
+		RandomStream b(42, 7, 3);
+		for(int i = 0; i < 100; i++) {
+			TS_ASSERT_EQUALS(a.nextInt(), b.nextInt());
+		}
+		TS_ASSERT_EQUALS(a.position(), 100);
+	}
+
+	void testStreamsAreIndependent() {
+		RandomStream seed(43, 7, 3);
+		RandomStream game(42, 8, 3);
+		RandomStream stream(42, 7, 4);
+		RandomStream base(42, 7, 3);
+		int same = 0;
+		for(int i = 0; i < 100; i++) {
+			unsigned int n = base.nextInt();
+			same += (n == seed.nextInt()) + (n == game.nextInt()) + (n == stream.nextInt());
+		}
+		TS_ASSERT_EQUALS(same, 0);
+	}
+
+	void testSkipAndSeek() {
+		RandomStream a(42, 0, 0);
+		RandomStream b(42, 0, 0);
+		for(int i = 0; i < 13; i++) {
+			a.nextInt();
+		}
+		b.skip(13);
+		TS_ASSERT_EQUALS(a.nextInt(), b.nextInt());
+		b.seek(2);
+		RandomStream c(42, 0, 0);
+		c.nextInt();
+		c.nextInt();
+		TS_ASSERT_EQUALS(b.nextInt(), c.nextInt());
+	}
+
+	void testNextBelow() {
+		RandomStream r(1, 0, 0);
+		int counts[6] = { 0, 0, 0, 0, 0, 0 };
+		for(int i = 0; i < 60000; i++) {
+			unsigned int n = r.nextBelow(6);
+			TS_ASSERT(n < 6);
+			counts[n % 6]++;
+		}
+		for(int i = 0; i < 6; i++) {
+			TS_ASSERT_DELTA(counts[i], 10000, 400);
+		}
+	}
+
+};
+
+#endif
@@ -0,0 +1,112 @@
+/**
+ * @file RingTest.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Contains unit tests for the templated Ring class.
+ */
+
+#ifndef RING_TEST_H
+#define RING_TEST_H
+
+//Protected includes
+#include <iostream>
+#include <string>
+#include <stdexcept>
+#include <cxxtest/TestSuite.h>
+
+//Class header include
+#include "../lib/Ring.h"
+
+using namespace std;
+
+class RingTest : public CxxTest::TestSuite {
+
+public:
+
+	/* Constructor Tests */
+
+	void testDefaultConstructor() {
+		Ring<int, 4> r;
+		TS_ASSERT_EQUALS(r.size(), 0);
+		TS_ASSERT_EQUALS(r.capacity(), 4);
+		TS_ASSERT_THROWS(r.front(), length_error);
+		TS_ASSERT_THROWS(r.back(), length_error);
+	}
+
+	/* Accessor Tests */
+
+	void testAtOnPopulatedRing() {
+		Ring<int, 4> r;
+		r.push(1);
+		r.push(2);
+		r.push(3);
+		TS_ASSERT_THROWS(r.at(-1), length_error);
+		TS_ASSERT_EQUALS(r.at(0), 1);
+		TS_ASSERT_EQUALS(r.at(1), 2);
+		TS_ASSERT_EQUALS(r.at(2), 3);
+		TS_ASSERT_THROWS(r.at(3), length_error);
+	}
+
+	void testFrontAndBack() {
+		Ring<string, 4> r;
+		r.push("Larry");
+		r.push("Curly");
+		r.push("Moe");
+		TS_ASSERT_EQUALS(r.front(), "Larry");
+		TS_ASSERT_EQUALS(r.back(), "Moe");
+		r.pop();
+		TS_ASSERT_EQUALS(r.front(), "Curly");
+		TS_ASSERT_EQUALS(r.back(), "Moe");
+	}
+
+	/* Mutator Tests */
+
+	void testPushOnFullRing() {
+		Ring<int, 2> r;
+		r.push(1);
+		r.push(2);
+		TS_ASSERT_THROWS(r.push(3), length_error);
+		TS_ASSERT_EQUALS(r.size(), 2);
+	}
+
+	void testPopOnEmptyRing() {
+		Ring<int, 2> r;
+		TS_ASSERT_THROWS(r.pop(), length_error);
+	}
+
+	void testWrapAround() {
+		//Cycle a card through the front and back of a full Ring many times
+		Ring<int, 3> r;
+		r.push(1);
+		r.push(2);
+		r.push(3);
+		for(int i = 0; i < 10; i++) {
+			int card = r.front();
+			r.pop();
+			r.push(card);
+		}
+		TS_ASSERT_EQUALS(r.at(0), 2);
+		TS_ASSERT_EQUALS(r.at(1), 3);
+		TS_ASSERT_EQUALS(r.at(2), 1);
+		//Remove a card, draw past it and return it to the back
+		r.pop();
+		r.push(r.front());
+		r.pop();
+		r.push(2);
+		TS_ASSERT_EQUALS(r.at(0), 1);
+		TS_ASSERT_EQUALS(r.at(1), 3);
+		TS_ASSERT_EQUALS(r.at(2), 2);
+	}
+
+	void testClear() {
+		Ring<int, 2> r;
+		r.push(1);
+		r.clear();
+		TS_ASSERT_EQUALS(r.size(), 0);
+		TS_ASSERT_THROWS(r.front(), length_error);
+	}
+
+};
+
+#endif
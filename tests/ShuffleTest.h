@@ -0,0 +1,135 @@
+/**
+ * @file ShuffleTest.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Contains unit tests for the ShuffleStream class, and for the shuffle policies
+ * that the engines apply with it.
+ */
+
+#ifndef SHUFFLE_TEST_H
+#define SHUFFLE_TEST_H
+
+//Protected includes
+#include <iostream>
+#include <string>
+#include <stdexcept>
+#include <cxxtest/TestSuite.h>
+
+//Class dependencies
+#include "../CardDecks.h"
+#include "../SimulatorConfig.h"
+#include "../BatchSimulator.h"
+
+//Class header include
+#include "../Shuffle.h"
+
+using namespace std;
+
+class ShuffleTest : public CxxTest::TestSuite {
+
+public:
+
+	void testShuffleIsPermutation() {
+		ShuffleStream s(42, 0, CardDecks::CHANCE_DECK);
+		for(int round = 0; round < 100; round++) {
+			unsigned char ids[CardDecks::MAXIMUM_DECK_SIZE];
+			for(int c = 0; c < 16; c++) {
+				ids[c] = c;
+			}
+			s.shuffle(ids, 16);
+			int seen[16] = { 0 };
+			for(int c = 0; c < 16; c++) {
+				seen[ids[c]]++;
+			}
+			for(int c = 0; c < 16; c++) {
+				TS_ASSERT_EQUALS(seen[c], 1);
+			}
+		}
+		//Decks of one card (or none) are left alone
+		int one = 7;
+		s.shuffle(&one, 1);
+		TS_ASSERT_EQUALS(one, 7);
+		s.shuffle(&one, 0);
+	}
+
+	void testSameAddressSameShuffles() {
+		ShuffleStream a(42, 3, CardDecks::CHANCE_DECK);
+		ShuffleStream b(42, 3, CardDecks::CHANCE_DECK);
+		ShuffleStream c(42, 3, CardDecks::COMMUNITY_CHEST_DECK);
+		int x[17], y[17], z[17];
+		int same = 0;
+		for(int c = 0; c < 17; c++) {
+			x[c] = y[c] = z[c] = c;
+		}
+		a.shuffle(x, 17);
+		b.shuffle(y, 17);
+		c.shuffle(z, 17);
+		for(int i = 0; i < 17; i++) {
+			TS_ASSERT_EQUALS(x[i], y[i]);
+			same += (x[i] == z[i]);
+		}
+		TS_ASSERT(same < 17);
+	}
+
+	void testSeek() {
+		//A stream moved to another's position continues with the same shuffles
+		ShuffleStream a(42, 0, 1);
+		int x[16], y[16];
+		for(int c = 0; c < 16; c++) {
+			x[c] = y[c] = c;
+		}
+		a.shuffle(x, 16);
+		ShuffleStream b(42, 0, 1);
+		b.seek(a.position());
+		for(int c = 0; c < 16; c++) {
+			x[c] = c;
+		}
+		a.shuffle(x, 16);
+		b.shuffle(y, 16);
+		for(int c = 0; c < 16; c++) {
+			TS_ASSERT_EQUALS(x[c], y[c]);
+		}
+	}
+
+	void testShufflesAreUniform() {
+		//Every card is equally likely to end up on top
+		ShuffleStream s(7, 0, 0);
+		int top[16] = { 0 };
+		for(int round = 0; round < 160000; round++) {
+			int ids[16];
+			for(int c = 0; c < 16; c++) {
+				ids[c] = c;
+			}
+			s.shuffle(ids, 16);
+			top[ids[0]]++;
+		}
+		for(int c = 0; c < 16; c++) {
+			TS_ASSERT_DELTA(top[c], 10000, 400);
+		}
+	}
+
+	void testPolicies() {
+		const char* argv[] = { "a.out", "2", "10", "1", "--shuffle", "exhausted" };
+		SimulatorConfig config(6, (char**)argv);
+		TS_ASSERT_EQUALS(config.shufflePolicy(), CardDecks::SHUFFLE_WHEN_EXHAUSTED);
+		TS_ASSERT_EQUALS(config.outputPath(), "output/2p10r1se.out");
+		TS_ASSERT_EQUALS(SimulatorConfig(2, 10, true, 1).shufflePolicy(), CardDecks::SHUFFLE_AT_START);
+		const char* bad[] = { "a.out", "2", "10", "1", "--shuffle", "sometimes" };
+		TS_ASSERT_THROWS(SimulatorConfig(6, (char**)bad), invalid_argument);
+		//Shuffled decks send the Players elsewhere than ordered ones
+		const char* none[] = { "a.out", "4", "200", "5", "--shuffle", "none" };
+		BatchSimulator shuffled((SimulatorConfig(4, 200, true, 5)));
+		BatchSimulator ordered((SimulatorConfig(6, (char**)none)));
+		shuffled.simulateGames(0, 64);
+		ordered.simulateGames(0, 64);
+		bool differs = false;
+		for(int i = 0; i < Board::BOARD_SIZE; i++) {
+			differs = differs || (shuffled.landingCount(i) != ordered.landingCount(i));
+		}
+		TS_ASSERT(differs);
+	}
+
+};
+
+#endif
@@ -0,0 +1,94 @@
+/**
+ * @file SolversTest.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Contains unit tests for the power iteration and BiCGSTAB solvers.
+ */
+
+#ifndef SOLVERS_TEST_H
+#define SOLVERS_TEST_H
+
+//Protected includes
+#include <string>
+#include <stdexcept>
+#include <vector>
+#include <cxxtest/TestSuite.h>
+
+//Class dependencies
+#include "../lib/SparseMatrix.h"
+#include "../lib/ThreadPool.h"
+
+//Class header include
+#include "../lib/Solvers.h"
+
+using namespace std;
+
+class SolversTest : public CxxTest::TestSuite {
+
+public:
+
+	void testPowerIteration() {
+		//A three-state chain (transposed) whose stationary distribution is (0.25, 0.5, 0.25)
+		vector<SparseMatrix::Entry> entries = {
+			{ 0, 0, 0.5 }, { 1, 0, 0.5 },
+			{ 0, 1, 0.25 }, { 1, 1, 0.5 }, { 2, 1, 0.25 },
+			{ 1, 2, 0.5 }, { 2, 2, 0.5 }
+		};
+		SparseMatrix m(3, 3, entries);
+		auto apply = [&m](const double* x, double* y) { m.multiply(x, y); };
+		vector<double> x = { 1.0, 0.0, 0.0 };
+		Solvers::Result result = Solvers::powerIteration(apply, x, 1e-12, 1000);
+		TS_ASSERT(result.converged);
+		TS_ASSERT_LESS_THAN(result.residual, 1e-12);
+		TS_ASSERT_DELTA(x[0], 0.25, 1e-10);
+		TS_ASSERT_DELTA(x[1], 0.5, 1e-10);
+		TS_ASSERT_DELTA(x[2], 0.25, 1e-10);
+	}
+
+	void testPowerIterationGivesUp() {
+		//Two states that swap every step never settle
+		vector<SparseMatrix::Entry> entries = { { 0, 1, 1.0 }, { 1, 0, 1.0 } };
+		SparseMatrix m(2, 2, entries);
+		auto apply = [&m](const double* x, double* y) { m.multiply(x, y); };
+		vector<double> x = { 1.0, 0.0 };
+		Solvers::Result result = Solvers::powerIteration(apply, x, 1e-12, 50);
+		TS_ASSERT(!result.converged);
+		TS_ASSERT_EQUALS(result.iterations, 50);
+	}
+
+	void testBicgstab() {
+		//A large, non-symmetric, diagonally dominant system, solved on several threads
+		const int n = 100000;
+		vector<SparseMatrix::Entry> entries;
+		for(int r = 0; r < n; r++) {
+			SparseMatrix::Entry diagonal = { r, r, 4.0 };
+			entries.push_back(diagonal);
+			if(r > 0) {
+				SparseMatrix::Entry left = { r, r - 1, -1.0 };
+				entries.push_back(left);
+			}
+			if(r + 1 < n) {
+				SparseMatrix::Entry right = { r, r + 1, -2.0 };
+				entries.push_back(right);
+			}
+		}
+		SparseMatrix m(n, n, entries);
+		ThreadPool pool(4);
+		auto apply = [&m, &pool](const double* x, double* y) { m.multiply(x, y, pool); };
+		vector<double> expected(n), b(n), x(n, 0.0);
+		for(int i = 0; i < n; i++) {
+			expected[i] = 1.0 + (i % 10);
+		}
+		apply(expected.data(), b.data());
+		Solvers::Result result = Solvers::bicgstab(apply, b, x, 1e-12, 1000);
+		TS_ASSERT(result.converged);
+		TS_ASSERT_LESS_THAN(result.iterations, 100);
+		for(int i = 0; i < n; i += 997) {
+			TS_ASSERT_DELTA(x[i], expected[i], 1e-8);
+		}
+	}
+
+};
+
+#endif
@@ -0,0 +1,100 @@
+/**
+ * @file SparseMatrixTest.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Contains unit tests for the SparseMatrix class.
+ */
+
+#ifndef SPARSE_MATRIX_TEST_H
+#define SPARSE_MATRIX_TEST_H
+
+//Protected includes
+#include <string>
+#include <stdexcept>
+#include <vector>
+#include <cxxtest/TestSuite.h>
+
+//Class dependencies
+#include "../lib/ThreadPool.h"
+
+//Class header include
+#include "../lib/SparseMatrix.h"
+
+using namespace std;
+
+class SparseMatrixTest : public CxxTest::TestSuite {
+
+public:
+
+	void testEmpty() {
+		SparseMatrix m;
+		TS_ASSERT_EQUALS(m.rows(), 0);
+		TS_ASSERT_EQUALS(m.columns(), 0);
+		TS_ASSERT_EQUALS(m.nonZeros(), 0);
+	}
+
+	void testBuild() {
+		//Entries out of order, with a duplicate and an empty row
+		vector<SparseMatrix::Entry> entries = {
+			{ 2, 1, 5.0 }, { 0, 2, 3.0 }, { 0, 0, 1.0 }, { 2, 1, 0.5 }, { 2, 0, 4.0 }
+		};
+		SparseMatrix m(3, 3, entries);
+		TS_ASSERT_EQUALS(m.rows(), 3);
+		TS_ASSERT_EQUALS(m.nonZeros(), 4);
+		TS_ASSERT_EQUALS(m.at(0, 0), 1.0);
+		TS_ASSERT_EQUALS(m.at(0, 1), 0.0);
+		TS_ASSERT_EQUALS(m.at(0, 2), 3.0);
+		TS_ASSERT_EQUALS(m.at(1, 1), 0.0);
+		TS_ASSERT_EQUALS(m.at(2, 0), 4.0);
+		TS_ASSERT_EQUALS(m.at(2, 1), 5.5);
+		vector<SparseMatrix::Entry> outside = { { 3, 0, 1.0 } };
+		TS_ASSERT_THROWS(SparseMatrix(3, 3, outside), out_of_range);
+	}
+
+	void testMultiply() {
+		vector<SparseMatrix::Entry> entries = {
+			{ 0, 0, 1.0 }, { 0, 2, 3.0 }, { 2, 0, 4.0 }, { 2, 1, 5.0 }
+		};
+		SparseMatrix m(3, 3, entries);
+		double x[] = { 1.0, 2.0, 3.0 };
+		double y[] = { -1.0, -1.0, -1.0 };
+		m.multiply(x, y);
+		TS_ASSERT_EQUALS(y[0], 10.0);
+		TS_ASSERT_EQUALS(y[1], 0.0);
+		TS_ASSERT_EQUALS(y[2], 14.0);
+	}
+
+	void testParallelMultiply() {
+		//A product too large to run on one thread gives the same result on several
+		const int n = 100000;
+		vector<SparseMatrix::Entry> entries;
+		for(int r = 0; r < n; r++) {
+			for(int k = 0; k < 1 + r % 7; k++) {
+				SparseMatrix::Entry entry = { r, (r * 31 + k * 977) % n, 1.0 / (1 + k) };
+				entries.push_back(entry);
+			}
+		}
+		SparseMatrix m(n, n, entries);
+		TS_ASSERT_LESS_THAN_EQUALS(SparseMatrix::PARALLEL_NON_ZEROS, m.nonZeros());
+		vector<double> x(n), serial(n), parallel(n);
+		for(int i = 0; i < n; i++) {
+			x[i] = (i % 13) * 0.25;
+		}
+		//The same pool's threads run one product after another
+		ThreadPool pool(5);
+		for(int product = 0; product < 3; product++) {
+			m.multiply(x.data(), serial.data());
+			m.multiply(x.data(), parallel.data(), pool);
+			TS_ASSERT(serial == parallel);
+			x.swap(serial);
+		}
+		ThreadPool single(1);
+		m.multiply(x.data(), parallel.data(), single);
+		m.multiply(x.data(), serial.data());
+		TS_ASSERT(serial == parallel);
+	}
+
+};
+
+#endif
@@ -0,0 +1,75 @@
+/**
+ * @file StatsObserverTest.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Contains unit tests for the StatsObserver class.
+ */
+
+#ifndef STATS_OBSERVER_TEST_H
+#define STATS_OBSERVER_TEST_H
+
+//Protected includes
+#include <sstream>
+#include <string>
+#include <cxxtest/TestSuite.h>
+
+//Class dependencies
+#include "../Property.h"
+#include "../CardDecks.h"
+#include "../SimulatorEvents.h"
+
+//Class header include
+#include "../StatsObserver.h"
+
+using namespace std;
+
+class StatsObserverTest : public CxxTest::TestSuite {
+
+public:
+
+	void testCounters() {
+		StatsObserver stats;
+		Property chance("Chance");
+		stats.notify(RoundEvent{ 0 });
+		stats.notify(TurnEvent{ 0, chance });
+		stats.notify(RollEvent{ 0, 2, 2 });
+		stats.notify(LandEvent{ 0, 7, chance });
+		stats.notify(DrawEvent{ 0, CardDecks::CHANCE_DECK, 0, CardDecks::CHANCE[0] });
+		stats.notify(RollEvent{ 0, 1, 5 });
+		stats.notify(ArrestEvent{ 0, ArrestEvent::GO_TO_JAIL_CARD });
+		stats.notify(TurnEvent{ 1, chance });
+		stats.notify(RollEvent{ 1, 3, 4 });
+		stats.notify(StayEvent{ 1 });
+		stats.notify(ReleaseEvent{ 1, ReleaseEvent::SENTENCE_SERVED });
+		TS_ASSERT_EQUALS(stats.rounds(), 1);
+		TS_ASSERT_EQUALS(stats.turns(), 2);
+		TS_ASSERT_EQUALS(stats.rolls(), 3);
+		TS_ASSERT_EQUALS(stats.doubles(), 1);
+		TS_ASSERT_EQUALS(stats.landings(), 1);
+		TS_ASSERT_EQUALS(stats.stays(), 1);
+		TS_ASSERT_EQUALS(stats.draws(CardDecks::CHANCE_DECK), 1);
+		TS_ASSERT_EQUALS(stats.draws(CardDecks::COMMUNITY_CHEST_DECK), 0);
+		TS_ASSERT_EQUALS(stats.arrests(ArrestEvent::GO_TO_JAIL_CARD), 1);
+		TS_ASSERT_EQUALS(stats.arrests(ArrestEvent::THIRD_DOUBLES), 0);
+		TS_ASSERT_EQUALS(stats.releases(ReleaseEvent::SENTENCE_SERVED), 1);
+		//Only the first turn has been finished by another TurnEvent
+		TS_ASSERT_EQUALS(stats.turnsByDoubles(0), 0);
+		TS_ASSERT_EQUALS(stats.turnsByDoubles(1), 1);
+	}
+
+	void testPhaseTimers() {
+		StatsObserver stats;
+		stats.notify(PhaseEvent{ PhaseEvent::DICE });
+		for(volatile int i = 0; i < 100000; i++) { }
+		stats.notify(PhaseEvent{ PhaseEvent::BETWEEN_TURNS });
+		TS_ASSERT(stats.ticks(PhaseEvent::DICE) > 0);
+		TS_ASSERT_EQUALS(stats.ticks(PhaseEvent::CARDS), 0ULL);
+		ostringstream output;
+		stats.print(output);
+		TS_ASSERT(output.str().find("Dice") != string::npos);
+	}
+
+};
+
+#endif
@@ -0,0 +1,120 @@
+/**
+ * @file SweepRunnerTest.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Contains unit tests for the Monopoly SweepRunner class.
+ */
+
+#ifndef SWEEP_RUNNER_TEST_H
+#define SWEEP_RUNNER_TEST_H
+
+//Protected includes
+#include <iostream>
+#include <string>
+#include <stdexcept>
+#include <cxxtest/TestSuite.h>
+
+//Class dependencies
+#include "../SimulatorConfig.h"
+#include "../Board.h"
+#include "../BatchSimulator.h"
+#include "../CardDecks.h"
+
+//Class header include
+#include "../SweepRunner.h"
+
+using namespace std;
+
+class SweepRunnerTest : public CxxTest::TestSuite {
+
+public:
+
+	void testListsAreParsed() {
+		SimulatorConfig config = this->config("2,4:6", "10:30:10", "7", "1");
+		TS_ASSERT(config.isSwept());
+		TS_ASSERT_EQUALS(config.sweepPlayers().size(), 4u);
+		TS_ASSERT_EQUALS(config.sweepPlayers()[1], 4);
+		TS_ASSERT_EQUALS(config.sweepPlayers()[3], 6);
+		TS_ASSERT_EQUALS(config.sweepTurns().size(), 3u);
+		TS_ASSERT_EQUALS(config.sweepTurns()[2], 30);
+		TS_ASSERT_EQUALS(config.sweepSeeds().size(), 1u);
+		TS_ASSERT_THROWS(this->config("1:3", "10", "7", "1"), invalid_argument);
+		TS_ASSERT_THROWS(this->config("3", "10:5", "7", "1"), invalid_argument);
+		TS_ASSERT_THROWS(this->config("3", "10", "7x", "1"), invalid_argument);
+	}
+
+	void testGridOrder() {
+		SweepRunner w(this->config("2:3", "5,10", "1:3", "1"));
+		TS_ASSERT_EQUALS(w.pointCount(), 12);
+		TS_ASSERT_EQUALS(w.point(0).player_count, 2);
+		TS_ASSERT_EQUALS(w.point(0).turn_count, 5);
+		TS_ASSERT_EQUALS(w.point(2).seed, 3);
+		TS_ASSERT_EQUALS(w.point(3).turn_count, 10);
+		TS_ASSERT_EQUALS(w.point(11).player_count, 3);
+	}
+
+	void testRowsMatchSeparateRuns() {
+		//300 seeds of 2 games is 3 blocks, some of them mixing seeds
+		const char* threads[] = { "1", "3" };
+		for(int t = 0; t < 2; t++) {
+			SweepRunner w(this->config("3,5", "20", "1:300", threads[t], "2"));
+			w.simulatePoints();
+			for(int p = 0; p < w.pointCount(); p += 37) {
+				const SweepRunner::Point& point = w.point(p);
+				BatchSimulator batch(this->config("3", "20", "1", "1", "2").atPoint(point.player_count, point.turn_count, point.seed));
+				batch.simulateGames(0, 2);
+				for(int i = 0; i < Board::BOARD_SIZE; i++) {
+					TS_ASSERT_EQUALS(point.counts[i], batch.landingCount(i));
+				}
+			}
+		}
+	}
+
+	void testBoardsAndShufflesAreGroups() {
+		char* argv[] = { (char*)"a.out", (char*)"3", (char*)"20", (char*)"42",
+						 (char*)"--sweep-boards", (char*)"classic,boards/tournament32.board",
+						 (char*)"--sweep-shuffle", (char*)"none,exhausted", (char*)"--sweep-seeds", (char*)"1:3",
+						 (char*)"--threads", (char*)"2", (char*)"--games", (char*)"2" };
+		SimulatorConfig config(14, argv);
+		SweepRunner w(config);
+		TS_ASSERT_EQUALS(w.pointCount(), 12);
+		TS_ASSERT_EQUALS(w.point(0).board, 0);
+		TS_ASSERT_EQUALS(w.point(0).shuffle, CardDecks::UNSHUFFLED);
+		TS_ASSERT_EQUALS(w.point(3).shuffle, CardDecks::SHUFFLE_WHEN_EXHAUSTED);
+		TS_ASSERT_EQUALS(w.point(6).board, 1);
+		TS_ASSERT_EQUALS(w.point(11).seed, 3);
+		//Each row holds a separate run's counts on its own board, with its own policy
+		w.simulatePoints();
+		for(int p = 0; p < w.pointCount(); p++) {
+			const SweepRunner::Point& point = w.point(p);
+			SimulatorConfig setting = config.onBoard(point.board, point.shuffle);
+			TS_ASSERT_EQUALS(setting.shufflePolicy(), point.shuffle);
+			BatchSimulator batch(setting.atPoint(point.player_count, point.turn_count, point.seed));
+			batch.simulateGames(0, 2);
+			for(int i = 0; i < setting.board()->size(); i++) {
+				TS_ASSERT_EQUALS(point.counts[i], batch.landingCount(i));
+			}
+		}
+		TS_ASSERT_EQUALS(config.onBoard(1, CardDecks::UNSHUFFLED).board()->size(), 32);
+		argv[5] = (char*)"classic,";
+		TS_ASSERT_THROWS(SimulatorConfig(14, argv), invalid_argument);
+		argv[5] = (char*)"classic";
+		argv[7] = (char*)"never";
+		TS_ASSERT_THROWS(SimulatorConfig(14, argv), invalid_argument);
+	}
+
+private:
+
+	SimulatorConfig config(const char* players, const char* turns, const char* seeds,
+						   const char* threads, const char* games = "1") {
+		char* argv[] = { (char*)"a.out", (char*)"3", (char*)"20", (char*)"42",
+						 (char*)"--sweep-players", (char*)players, (char*)"--sweep-turns", (char*)turns,
+						 (char*)"--sweep-seeds", (char*)seeds, (char*)"--threads", (char*)threads,
+						 (char*)"--games", (char*)games };
+		return SimulatorConfig(14, argv);
+	}
+
+};
+
+#endif
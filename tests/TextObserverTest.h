@@ -0,0 +1,60 @@
+/**
+ * @file TextObserverTest.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Contains unit tests for the TextObserver class.
+ */
+
+#ifndef TEXT_OBSERVER_TEST_H
+#define TEXT_OBSERVER_TEST_H
+
+//Protected includes
+#include <sstream>
+#include <string>
+#include <cxxtest/TestSuite.h>
+
+//Class dependencies
+#include "../Property.h"
+#include "../CardDecks.h"
+#include "../SimulatorEvents.h"
+
+//Class header include
+#include "../TextObserver.h"
+
+using namespace std;
+
+class TextObserverTest : public CxxTest::TestSuite {
+
+public:
+
+	void testRollAndLand() {
+		ostringstream output;
+		TextObserver observer(output);
+		Property boardwalk("Boardwalk");
+		observer.notify(RollEvent{ 2, 3, 4 });
+		observer.notify(LandEvent{ 2, 39, boardwalk });
+		TS_ASSERT_EQUALS(output.str(), "Player 2 rolls 3+4\nPlayer 2 landed on Boardwalk\n");
+	}
+
+	void testDraw() {
+		ostringstream output;
+		TextObserver observer(output);
+		observer.notify(DrawEvent{ 1, CardDecks::CHANCE_DECK, 0, CardDecks::CHANCE[0] });
+		observer.notify(DrawEvent{ 1, CardDecks::COMMUNITY_CHEST_DECK, 0, CardDecks::COMMUNITY_CHEST[0] });
+		TS_ASSERT_EQUALS(output.str(), " -> Chance - Advance to Go\nPlayer 1 drew a 'Advance to Go'\n");
+	}
+
+	void testArrestAndRelease() {
+		ostringstream output;
+		TextObserver observer(output);
+		observer.notify(ArrestEvent{ 0, ArrestEvent::THIRD_DOUBLES });
+		observer.notify(ReleaseEvent{ 0, ReleaseEvent::DOUBLES });
+		TS_ASSERT_EQUALS(output.str(), "Player 0 has rolled 'doubles' three times!\n"
+									   " -> Player 0 is hauled off to Jail!\n"
+									   " -> Player 0 was released from Jail!\n");
+	}
+
+};
+
+#endif
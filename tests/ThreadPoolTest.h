@@ -0,0 +1,72 @@
+/**
+ * @file ThreadPoolTest.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Contains unit tests for the ThreadPool class.
+ */
+
+#ifndef THREAD_POOL_TEST_H
+#define THREAD_POOL_TEST_H
+
+//Protected includes
+#include <atomic>
+#include <string>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include <cxxtest/TestSuite.h>
+
+//Class header include
+#include "../lib/ThreadPool.h"
+
+using namespace std;
+
+class ThreadPoolTest : public CxxTest::TestSuite {
+
+public:
+
+	void testEveryWorkerRunsEachTask() {
+		ThreadPool pool(4);
+		TS_ASSERT_EQUALS(pool.threadCount(), 4);
+		vector<int> runs(4, 0);
+		for(int task = 0; task < 1000; task++) {
+			pool.run([&runs](int worker) { runs[worker]++; });
+		}
+		for(int w = 0; w < 4; w++) {
+			TS_ASSERT_EQUALS(runs[w], 1000);
+		}
+	}
+
+	void testCallerIsTheFirstWorker() {
+		thread::id caller = this_thread::get_id();
+		ThreadPool pool(3);
+		vector<thread::id> ids(3);
+		pool.run([&ids](int worker) { ids[worker] = this_thread::get_id(); });
+		TS_ASSERT(ids[0] == caller);
+		TS_ASSERT(ids[1] != caller && ids[2] != caller && ids[1] != ids[2]);
+		//A pool of one thread (or fewer) starts none of its own
+		ThreadPool single(0);
+		TS_ASSERT_EQUALS(single.threadCount(), 1);
+		single.run([&ids](int worker) { ids[worker] = this_thread::get_id(); });
+		TS_ASSERT(ids[0] == caller);
+	}
+
+	void testExceptionsReachTheCaller() {
+		ThreadPool pool(3);
+		atomic<int> finished(0);
+		TS_ASSERT_THROWS(pool.run([&finished](int worker) {
+			if(worker == 2) {
+				throw runtime_error("Worker 2 failed!");
+			}
+			finished++;
+		}), runtime_error);
+		//The other workers still finished, and the pool still runs tasks
+		TS_ASSERT_EQUALS(finished.load(), 2);
+		pool.run([&finished](int worker) { finished++; });
+		TS_ASSERT_EQUALS(finished.load(), 5);
+	}
+
+};
+
+#endif
@@ -0,0 +1,128 @@
+/**
+ * @file TraceTest.h
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Contains unit tests for the TraceWriter and TraceReader classes.
+ */
+
+#ifndef TRACE_TEST_H
+#define TRACE_TEST_H
+
+//Protected includes
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <stdexcept>
+#include <cxxtest/TestSuite.h>
+
+//Class dependencies
+#include "../SimulatorConfig.h"
+#include "../SimulatorEvents.h"
+#include "../TextObserver.h"
+#include "../Board.h"
+#include "../CardDecks.h"
+
+//Class header include
+#include "../Trace.h"
+
+using namespace std;
+
+class TraceTest : public CxxTest::TestSuite {
+
+public:
+
+	void testHeader() {
+		this->writeTrace();
+		TraceReader reader(TRACE_PATH);
+		TS_ASSERT_EQUALS(reader.playerCount(), 3);
+		TS_ASSERT_EQUALS(reader.turnCount(), 10);
+		TS_ASSERT_EQUALS(reader.seed(), 42);
+		TS_ASSERT_EQUALS(reader.board().size(), Board::BOARD_SIZE);
+		TS_ASSERT_EQUALS(string(reader.board().propertyAt(39).name()), "Boardwalk");
+		TS_ASSERT_EQUALS(reader.board().propertyAt(30).kind(), Property::GO_TO_JAIL);
+		TS_ASSERT_EQUALS(reader.deckSize(CardDecks::CHANCE_DECK), CardDecks::SIZE[CardDecks::CHANCE_DECK]);
+		TS_ASSERT_EQUALS(reader.card(CardDecks::CHANCE_DECK, 7).effect(), Card::MOVE_BY);
+		TS_ASSERT_EQUALS(reader.card(CardDecks::CHANCE_DECK, 7).argument(), -3);
+		remove(TRACE_PATH);
+	}
+
+	void testReplay() {
+		//Replaying the trace produces the same text as observing the events directly
+		ostringstream expected;
+		TextObserver direct(expected);
+		this->playEvents(direct);
+		this->writeTrace();
+		ostringstream replayed;
+		TextObserver observer(replayed);
+		TraceReader reader(TRACE_PATH);
+		reader.replay(observer);
+		TS_ASSERT_EQUALS(replayed.str(), expected.str());
+		//Landings (including the arrest) are counted on the recorded Board
+		TS_ASSERT_EQUALS(reader.board().propertyAt(7).count(), 1);
+		TS_ASSERT_EQUALS(reader.board().propertyAt(4).count(), 1);
+		TS_ASSERT_EQUALS(reader.board().propertyAt(Board::JAIL_LOCATION).count(), 1);
+		remove(TRACE_PATH);
+	}
+
+	void testNotATrace() {
+		ofstream file(TRACE_PATH);
+		file << "Num Players: 3 Turns: 10\n";
+		file.close();
+		TS_ASSERT_THROWS(TraceReader reader(TRACE_PATH), runtime_error);
+		remove(TRACE_PATH);
+	}
+
+	void testMalformedRecords() {
+		//A draw from a third deck, or a release for a fourth reason, is refused before it's looked up
+		const unsigned char bad[][2] = {
+			{ Trace::tag(Trace::DRAW, 2, 0), 0 },
+			{ Trace::tag(Trace::DRAW, 3, 1), 0 },
+			{ Trace::tag(Trace::RELEASE, 3, 0), 0 }
+		};
+		for(int b = 0; b < 3; b++) {
+			this->writeTrace();
+			ofstream file(TRACE_PATH, ofstream::out | ofstream::app | ofstream::binary);
+			file.write((const char*)bad[b], (bad[b][0] & 7) == Trace::DRAW ? 2 : 1);
+			file.close();
+			TraceReader reader(TRACE_PATH);
+			NullObserver observer;
+			TS_ASSERT_THROWS(reader.replay(observer), runtime_error);
+		}
+		remove(TRACE_PATH);
+	}
+
+private:
+
+	static constexpr const char* TRACE_PATH = "TraceTest.trace";
+
+	/* Reports a short game to an observer: a Chance card sends Player 1 back three spaces */
+	template<class Observer> void playEvents(Observer& observer) {
+		Board board;
+		board.populateClassic();
+		observer.notify(RoundEvent{ 0 });
+		observer.notify(TurnEvent{ 1, board.propertyAt(0) });
+		observer.notify(RollEvent{ 1, 3, 4 });
+		observer.notify(LandEvent{ 1, 7, board.propertyAt(7) });
+		observer.notify(DrawEvent{ 1, CardDecks::CHANCE_DECK, 7, CardDecks::CHANCE[7] });
+		observer.notify(LandEvent{ 1, 4, board.propertyAt(4) });
+		observer.notify(TurnEvent{ 2, board.propertyAt(0) });
+		observer.notify(RollEvent{ 2, 6, 6 });
+		observer.notify(ArrestEvent{ 2, ArrestEvent::THIRD_DOUBLES });
+		observer.notify(RoundEvent{ 1 });
+		observer.notify(TurnEvent{ 2, board.propertyAt(Board::JAIL_LOCATION) });
+		observer.notify(StayEvent{ 2 });
+		observer.notify(ReleaseEvent{ 2, ReleaseEvent::GET_OUT_OF_JAIL_FREE });
+	}
+
+	void writeTrace() {
+		const char* argv[] = { "a.out", "3", "10", "42", "-v", "--trace" };
+		SimulatorConfig config(6, (char**)argv);
+		TraceWriter writer(TRACE_PATH, config);
+		this->playEvents(writer);
+	}
+
+};
+
+#endif
@@ -0,0 +1,53 @@
+/**
+ * @file trace2text.cpp
+ * @author Michael Zalla
+ * @date 10-17-2026
+ *
+ * Converts a binary trace (see 'Trace.h') back into the text that the Simulator
+ * writes in verbose mode, and prints it to standard output. Takes one mandatory
+ * command-line argument:
+ *
+ * 		1. The path of a trace file 	[REQUIRED]
+ *
+ * The output is identical to the '.out' file of the same run without '--trace'.
+ */
+
+//Protected includes
+#include <cstdlib>
+#include <iostream>
+
+//Class dependencies
+#include "Trace.h"
+#include "TextObserver.h"
+#include "Board.h"
+
+using namespace std;
+
+int main(int argc, char *argv[]) {
+
+	if(argc != 2) {
+		cerr << "Usage: " << argv[0] << " <trace file>\n";
+		return EXIT_FAILURE;
+	}
+
+	//The trace carries its own board and decks, so any board's trace can be converted
+	TraceReader reader(argv[1]);
+
+	//Config summary, as written by Simulator::printConfigSummary()
+	cout << "Num Players: " << reader.playerCount() << " ";
+	cout << "Turns: " << reader.turnCount() << "\n";
+	cout << "Verbose: " << 1 << "\n";
+	//Events
+	TextObserver observer(cout);
+	reader.replay(observer);
+	//Property statistics, as written by Simulator::printPropertyStatistics()
+	cout << "\n";
+	const Board& board = reader.board();
+	for(int i = 0; i < board.size(); i++) {
+		cout << board.propertyAt(i).name() << " :: " << board.propertyAt(i).count() << "\n";
+	}
+	cout << "\n";
+
+	return EXIT_SUCCESS;
+
+}